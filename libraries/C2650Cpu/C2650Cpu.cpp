@@ -429,8 +429,12 @@ C2650Cpu::memoryRead(
     UINT16 *data
 )
 {
+    BUS_STATS_INC(reads);
+
     if (address > (UINT32) 0xFFFF)
     {
+        BUS_STATS_INC(ioCycles);
+
         digitalWrite(g_pinMap40DIL[s_M_IO_o.pin], LOW);
     }
     else
@@ -449,8 +453,12 @@ C2650Cpu::memoryWrite(
     UINT16 data
 )
 {
+    BUS_STATS_INC(writes);
+
     if (address > (UINT32) 0xFFFF)
     {
+        BUS_STATS_INC(ioCycles);
+
         digitalWrite(g_pinMap40DIL[s_M_IO_o.pin], LOW);
     }
     else
@@ -476,6 +484,7 @@ C2650Cpu::read(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
 
     // Set a read cycle.
     digitalWrite(g_pinMap40DIL[s__RW_o.pin], LOW);
@@ -606,9 +615,10 @@ C2650Cpu::read(
 
 Exit:
 
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
     return error;
 }
@@ -625,6 +635,7 @@ C2650Cpu::write(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
 
     // Set a write cycle.
     digitalWrite(g_pinMap40DIL[s__RW_o.pin], HIGH);
@@ -758,9 +769,10 @@ C2650Cpu::write(
 
 Exit:
 
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
 
     return error;
@@ -833,6 +845,8 @@ C2650Cpu::acknowledgeInterrupt(
     UINT16 *response
 )
 {
+    BUS_STATS_INC(interruptAcks);
+
     digitalWrite(g_pinMap40DIL[s_M_IO_o.pin], LOW);
 
     digitalWrite(g_pinMap40DIL[s_INTACK_o.pin], HIGH);
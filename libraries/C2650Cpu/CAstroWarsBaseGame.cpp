@@ -78,7 +78,7 @@ CAstroWarsBaseGame::onBankSwitchFlagLo(
 {
     PERROR              error     = errorSuccess;
     CAstroWarsBaseGame *thisGame  = (CAstroWarsBaseGame *) cAstroWarsBaseGame;
-    C2650Cpu           *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu           *cpu       = (C2650Cpu *) thisGame->cpu();
 
     cpu->flagWrite(LOW);
 
@@ -93,7 +93,7 @@ CAstroWarsBaseGame::onBankSwitchFlagHi(
 {
     PERROR              error     = errorSuccess;
     CAstroWarsBaseGame *thisGame  = (CAstroWarsBaseGame *) cAstroWarsBaseGame;
-    C2650Cpu           *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu           *cpu       = (C2650Cpu *) thisGame->cpu();
 
     cpu->flagWrite(HIGH);
 
@@ -192,7 +192,7 @@ CCvsBaseGame::onBankSwitchFlagLo(
 {
     PERROR        error     = errorSuccess;
     CCvsBaseGame *thisGame  = (CCvsBaseGame *) cCvsBaseGame;
-    C2650Cpu     *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu     *cpu       = (C2650Cpu *) thisGame->cpu();
 
     cpu->flagWrite(LOW);
 
@@ -207,7 +207,7 @@ CCvsBaseGame::onBankSwitchFlagHi(
 {
     PERROR        error     = errorSuccess;
     CCvsBaseGame *thisGame  = (CCvsBaseGame *) cCvsBaseGame;
-    C2650Cpu     *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu     *cpu       = (C2650Cpu *) thisGame->cpu();
 
     cpu->flagWrite(HIGH);
 
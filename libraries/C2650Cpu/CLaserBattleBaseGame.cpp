@@ -205,7 +205,7 @@ CLaserBattleBaseGame::onBankSwitchBackgroundRam(
 {
     PERROR               error     = errorSuccess;
     CLaserBattleBaseGame *thisGame  = (CLaserBattleBaseGame *) cLaserBattleBaseGame;
-    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // cnt_nav_w
     // |  4  | MPX BKEFF | access background RAM or effect RAM  |
@@ -223,7 +223,7 @@ CLaserBattleBaseGame::onBankSwitchEffectRam(
 {
     PERROR               error     = errorSuccess;
     CLaserBattleBaseGame *thisGame  = (CLaserBattleBaseGame *) cLaserBattleBaseGame;
-    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // cnt_nav_w
     // |  4  | MPX BKEFF | access background RAM or effect RAM  |
@@ -241,7 +241,7 @@ CLaserBattleBaseGame::onBankSwitchIN0(
 {
     PERROR                error     = errorSuccess;
     CLaserBattleBaseGame *thisGame  = (CLaserBattleBaseGame *) cLaserBattleBaseGame;
-    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // cnt_eff_w
     // |  7  | MPX P_1/2   | selects input row 2
@@ -268,7 +268,7 @@ CLaserBattleBaseGame::onBankSwitchIN1(
 {
     PERROR                error     = errorSuccess;
     CLaserBattleBaseGame *thisGame  = (CLaserBattleBaseGame *) cLaserBattleBaseGame;
-    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // cnt_eff_w
     // |  7  | MPX P_1/2   | selects input row 2
@@ -295,7 +295,7 @@ CLaserBattleBaseGame::onBankSwitchSW1(
 {
     PERROR                error     = errorSuccess;
     CLaserBattleBaseGame *thisGame  = (CLaserBattleBaseGame *) cLaserBattleBaseGame;
-    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // cnt_eff_w
     // |  7  | MPX P_1/2   | selects input row 2
@@ -322,7 +322,7 @@ CLaserBattleBaseGame::onBankSwitchSW2(
 {
     PERROR                error     = errorSuccess;
     CLaserBattleBaseGame *thisGame  = (CLaserBattleBaseGame *) cLaserBattleBaseGame;
-    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu             *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // cnt_eff_w
     // |  7  | MPX P_1/2   | selects input row 2
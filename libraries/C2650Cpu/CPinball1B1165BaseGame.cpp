@@ -193,8 +193,8 @@ CPinball1B1165BaseGame::nvRamCrc(
         error = errorCustom;
 
         error->code = ERROR_SUCCESS;
-        error->description = "OK:";
-        error->description += nvRamRegion.location;
+        stringCopy(error->description, "OK:");
+        stringAppend(error->description, nvRamRegion.location);
         STRING_UINT32_HEX(error->description, crc);
     }
 
@@ -83,7 +83,7 @@ CQuasarBaseGame::onBankSwitchCharacterRam(
 {
     PERROR           error     = errorSuccess;
     CQuasarBaseGame *thisGame  = (CQuasarBaseGame *) cQuasarBaseGame;
-    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // Data is ignored, A1-A0 are latched
     error = cpu->memoryWrite(0x12000, 0);
@@ -99,7 +99,7 @@ CQuasarBaseGame::onBankSwitchColourRam(
 {
     PERROR           error     = errorSuccess;
     CQuasarBaseGame *thisGame  = (CQuasarBaseGame *) cQuasarBaseGame;
-    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // Data is ignored, A1-A0 are latched.
     error = cpu->memoryWrite(0x12001, 0);
@@ -115,7 +115,7 @@ CQuasarBaseGame::onBankSwitchEffectRam(
 {
     PERROR           error     = errorSuccess;
     CQuasarBaseGame *thisGame  = (CQuasarBaseGame *) cQuasarBaseGame;
-    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // Data is ignored, A1-A0 are latched.
     error = cpu->memoryWrite(0x12002, 0);
@@ -131,7 +131,7 @@ CQuasarBaseGame::onBankSwitchEffectBlank(
 {
     PERROR           error     = errorSuccess;
     CQuasarBaseGame *thisGame  = (CQuasarBaseGame *) cQuasarBaseGame;
-    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // Data is ignored, A1-A0 are latched.
     error = cpu->memoryWrite(0x12003, 0);
@@ -147,7 +147,7 @@ CQuasarBaseGame::onBankSwitchIN0(
 {
     PERROR           error     = errorSuccess;
     CQuasarBaseGame *thisGame  = (CQuasarBaseGame *) cQuasarBaseGame;
-    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // Data is ignored, A1-A0 are latched
     error = cpu->memoryWrite(0x12008, 0);
@@ -163,7 +163,7 @@ CQuasarBaseGame::onBankSwitchIN1(
 {
     PERROR           error     = errorSuccess;
     CQuasarBaseGame *thisGame  = (CQuasarBaseGame *) cQuasarBaseGame;
-    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // Data is ignored, A1-A0 are latched
     error = cpu->memoryWrite(0x12009, 0);
@@ -179,7 +179,7 @@ CQuasarBaseGame::onBankSwitchSW1(
 {
     PERROR           error     = errorSuccess;
     CQuasarBaseGame *thisGame  = (CQuasarBaseGame *) cQuasarBaseGame;
-    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // Data is ignored, A1-A0 are latched
     error = cpu->memoryWrite(0x1200A, 0);
@@ -195,7 +195,7 @@ CQuasarBaseGame::onBankSwitchSW2(
 {
     PERROR           error     = errorSuccess;
     CQuasarBaseGame *thisGame  = (CQuasarBaseGame *) cQuasarBaseGame;
-    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->m_cpu;
+    C2650Cpu        *cpu       = (C2650Cpu *) thisGame->cpu();
 
     // Data is ignored, A1-A0 are latched
     error = cpu->memoryWrite(0x1200B, 0);
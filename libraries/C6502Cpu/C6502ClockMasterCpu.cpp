@@ -45,7 +45,8 @@ C6502ClockMasterCpu::C6502ClockMasterCpu(
     m_pinRDY(g_pinMap40DIL, &s_RDY_i),
     m_pinClock(g_pinMap8Aux, &s_Clock_o),
     m_valueCLK1o(-1), // Force initial state matching
-    m_valueCLK2o(-1)  // Force initial state matching
+    m_valueCLK2o(-1), // Force initial state matching
+    m_clockCount(0)
 {
 };
 
@@ -226,6 +227,7 @@ C6502ClockMasterCpu::memoryReadWrite(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
 
     // Critical timing section
     noInterrupts();
@@ -341,9 +343,10 @@ C6502ClockMasterCpu::memoryReadWrite(
 
 Exit:
 
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
 
     return error;
@@ -356,6 +359,8 @@ C6502ClockMasterCpu::memoryRead(
     UINT16 *data
 )
 {
+    BUS_STATS_INC(reads);
+
     return memoryReadWrite(address, data, HIGH);
 }
 
@@ -366,6 +371,8 @@ C6502ClockMasterCpu::memoryWrite(
     UINT16 data
 )
 {
+    BUS_STATS_INC(writes);
+
     return memoryReadWrite(address, &data, LOW);
 }
 
@@ -408,6 +415,8 @@ C6502ClockMasterCpu::clockPulse(
     m_pinClock.digitalWriteHIGH();
     m_pinClock.digitalWriteLOW();
 
+    m_clockCount++;
+
     if (m_pinCLK0i.digitalRead() == HIGH)
     {
         // From the Synertek datasheet timing diagram on CLK0 Hi transitions CLK1 leads.
@@ -438,3 +447,27 @@ C6502ClockMasterCpu::clockPulse(
     }
 }
 
+//
+// Unlike the 6809E the CLK0 input has to be checked after every pulse to
+// drive CLK1 & CLK2 and so this can't be a single burst on the pin. The
+// call is bound statically to avoid the virtual call on each pulse.
+//
+void
+C6502ClockMasterCpu::clockPulses(
+    UINT32 count
+)
+{
+    while (count-- != 0)
+    {
+        C6502ClockMasterCpu::clockPulse();
+    }
+}
+
+
+UINT32
+C6502ClockMasterCpu::clockCount(
+)
+{
+    return m_clockCount;
+}
+
@@ -26,13 +26,13 @@
 #define C6502ClockMasterCpu_h
 
 #include "Arduino.h"
-#include "ICpu.h"
+#include "IClockMasterCpu.h"
 #include "CBus.h"
 #include "CFast8BitBus.h"
 #include "CFastPin.h"
 
 
-class C6502ClockMasterCpu : public ICpu
+class C6502ClockMasterCpu : public IClockMasterCpu
 {
     public:
 
@@ -105,13 +105,25 @@ class C6502ClockMasterCpu : public ICpu
         );
 
         //
-        // C6502ClockMasterCpu Interface
+        // IClockMasterCpu Interface
         //
 
+        virtual
         void
         clockPulse(
         );
 
+        virtual
+        void
+        clockPulses(
+            UINT32 count
+        );
+
+        virtual
+        UINT32
+        clockCount(
+        );
+
     private:
 
         PERROR
@@ -139,6 +151,8 @@ class C6502ClockMasterCpu : public ICpu
         int           m_valueCLK1o;
         int           m_valueCLK2o;
 
+        UINT32        m_clockCount;
+
 };
 
 #endif
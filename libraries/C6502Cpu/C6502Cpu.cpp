@@ -178,6 +178,9 @@ C6502Cpu::memoryRead(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
+
+    BUS_STATS_INC(reads);
 
     // Set a read cycle.
     digitalWrite(g_pinMap40DIL[s_R_W_o.pin], HIGH);
@@ -205,9 +208,10 @@ C6502Cpu::memoryRead(
 
 Exit:
 
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
 
     return error;
@@ -222,6 +226,9 @@ C6502Cpu::memoryWrite(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
+
+    BUS_STATS_INC(writes);
 
     // Set a write cycle.
     digitalWrite(g_pinMap40DIL[s_R_W_o.pin], LOW);
@@ -250,9 +257,10 @@ C6502Cpu::memoryWrite(
 
 Exit:
 
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
 
     return error;
@@ -371,7 +371,10 @@ C68000DedicatedCpu::memoryRead(
     bool   lo    = (address & 1) ? true : false;
     bool   vpa   = (address & s_vpaAddress) ? true : false;
 
-    // Critical timing section
+    BUS_STATS_INC(reads);
+
+    // Critical timing section, the caller's interrupt state is restored after.
+    UINT8 sreg = SREG;
     noInterrupts();
 
     error = outputAddress(address, true);
@@ -411,7 +414,7 @@ C68000DedicatedCpu::memoryRead(
 
 Exit:
 
-    interrupts();
+    SREG = sreg;
 
     return error;
 }
@@ -428,7 +431,10 @@ C68000DedicatedCpu::memoryWrite(
     bool   vpa   = (address & s_vpaAddress) ? true : false;
     UINT16 dummyData;
 
-    // Critical timing section
+    BUS_STATS_INC(writes);
+
+    // Critical timing section, the caller's interrupt state is restored after.
+    UINT8 sreg = SREG;
     noInterrupts();
 
     error = outputAddress(address, false);
@@ -474,7 +480,7 @@ C68000DedicatedCpu::memoryWrite(
 
 Exit:
 
-    interrupts();
+    SREG = sreg;
 
     return error;
 }
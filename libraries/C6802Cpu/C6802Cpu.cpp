@@ -223,6 +223,8 @@ C6802Cpu::memoryRead(
     PERROR error = errorSuccess;
     UINT16 data16 = 0;
 
+    BUS_STATS_INC(reads);
+
     // Enable the address bus and set the value
     m_busA.pinMode(OUTPUT);
     m_busA.digitalWrite((UINT16) (address & 0xFFFF));
@@ -230,7 +232,8 @@ C6802Cpu::memoryRead(
     // Set up a read cycle
     m_pinR_W.digitalWrite(HIGH);
 
-    // Critical timing section
+    // Critical timing section, the caller's interrupt state is restored after.
+    UINT8 sreg = SREG;
     noInterrupts();
 
     // pulse the clock to high
@@ -243,7 +246,7 @@ C6802Cpu::memoryRead(
     // pulse the clock to low
     m_pinE.digitalWrite(LOW);
 
-    interrupts();
+    SREG = sreg;
 
     *data = data16;
 
@@ -259,6 +262,8 @@ C6802Cpu::memoryWrite(
 {
     PERROR error = errorSuccess;
 
+    BUS_STATS_INC(writes);
+
     // Enable the address bus and set the value
     m_busA.pinMode(OUTPUT);
     m_busA.digitalWrite((UINT16) (address & 0xFFFF));
@@ -266,7 +271,8 @@ C6802Cpu::memoryWrite(
     // Set up a write cycle
     m_pinR_W.digitalWrite(LOW);
 
-    // Critical timing section
+    // Critical timing section, the caller's interrupt state is restored after.
+    UINT8 sreg = SREG;
     noInterrupts();
 
     // pulse the clock to high
@@ -279,7 +285,7 @@ C6802Cpu::memoryWrite(
     // pulse the clock to low
     m_pinE.digitalWrite(LOW);
 
-    interrupts();
+    SREG = sreg;
 
     // Go back to read mode
     m_pinR_W.digitalWrite(HIGH);
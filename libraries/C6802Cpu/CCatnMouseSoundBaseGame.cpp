@@ -120,11 +120,12 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 // NOTE: This implementation uses Money Money schematic IC designators that may not match the CnM PCB !!!!
 //
-static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                    "0123456789"
-                                                            {CCatnMouseSoundBaseGame::ayIdle,     "AY Idle   "},
-                                                            {CCatnMouseSoundBaseGame::mcCheck,    "MC Check  "},
-                                                            {CCatnMouseSoundBaseGame::ay4GCheck,  "AY4G Check"}, // Money Money designator
-                                                            {CCatnMouseSoundBaseGame::ay4HCheck,  "AY4H Check"}, // Money Money designator
+static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                     "0123456789"
+                                                            {CCatnMouseSoundBaseGame::ayIdle,      "AY Idle   "},
+                                                            {CCatnMouseSoundBaseGame::mcCheck,     "MC Check  "},
+                                                            {CCatnMouseSoundBaseGame::ay4GCheck,   "AY4G Check"}, // Money Money designator
+                                                            {CCatnMouseSoundBaseGame::ay4HCheck,   "AY4H Check"}, // Money Money designator
+                                                            {CCatnMouseSoundBaseGame::ayRegisters, "AY Regs   "},
                                                             {NO_CUSTOM_FUNCTION}}; // end of list
 
 
@@ -240,3 +241,22 @@ CCatnMouseSoundBaseGame::ay4HCheck(
     return pThis->m_ay[1]->check();
 }
 
+
+// Walking bit & uniqueness check of the AY-3-8910's registers.
+PERROR
+CCatnMouseSoundBaseGame::ayRegisters(
+    void *cCatnMouseSoundBaseGame
+)
+{
+    CCatnMouseSoundBaseGame *pThis = (CCatnMouseSoundBaseGame *) cCatnMouseSoundBaseGame;
+    PERROR error = errorSuccess;
+
+    error = pThis->m_ay[0]->registers();
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[1]->registers();
+    }
+
+    return error;
+}
+
@@ -57,6 +57,10 @@ class CCatnMouseSoundBaseGame : public CGame
             void *cScrambleSoundBaseGame
         );
 
+        static PERROR ayRegisters(
+            void *cScrambleSoundBaseGame
+        );
+
     protected:
 
         CCatnMouseSoundBaseGame(
@@ -241,7 +241,7 @@ CWmsSoundBaseGame::interruptCheck(
     PERROR error = errorSuccess;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "/IRQ Tested!";
+    stringCopy(errorCustom->description, "/IRQ Tested!");
 
     // Set the CR to ensure we are set up for IRQ
     m_cpu->memoryWrite(addressPIA1B+1, 0x37);
@@ -286,7 +286,7 @@ CWmsSoundBaseGame::soundTestDAC(
     ICpu              *cpu      = thisGame->m_cpu;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "DAC Tested!";
+    stringCopy(errorCustom->description, "DAC Tested!");
 
     // Firstly initialse PIA1A in case the output test hasn't been run
 
@@ -375,7 +375,7 @@ CWmsSoundBaseGame::soundTestCVSDM(
     ICpu              *cpu      = thisGame->m_cpu;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "CVSDM Tested!";
+    stringCopy(errorCustom->description, "CVSDM Tested!");
 
     // Disable CA1 (xxxxxx00), Set PR (xxxxx1xx), Set CA2 speech data output low (xx110xxx)
     error = cpu->memoryWrite(addressPIA1A+1, 0x34);
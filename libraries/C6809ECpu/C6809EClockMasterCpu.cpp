@@ -49,7 +49,8 @@ C6809EClockMasterCpu::C6809EClockMasterCpu(const C6809EPinOut *pinOut
     m_pinRW(g_pinMap40DIL, &pinOut->m_RW_o),
     m_pinE(g_pinMap40DIL, &pinOut->m_E_i),
     m_pinQ(g_pinMap40DIL, &pinOut->m_Q_i),
-    m_pinClock(g_pinMap8Aux, &s_Clock_o)
+    m_pinClock(g_pinMap8Aux, &s_Clock_o),
+    m_clockCount(0)
 {
 };
 
@@ -255,9 +256,11 @@ C6809EClockMasterCpu::memoryReadWrite(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
     int valueE;
     int valueQ;
     UINT16 dataN[2] = {0};
+    int x; // Also the number of clocks run by each phase loop.
 
     // Critical timing section
     noInterrupts();
@@ -268,7 +271,7 @@ C6809EClockMasterCpu::memoryReadWrite(
     // - Wait for E-Lo, Q-Lo
     // - E-falling
     //
-    for (int x = 0 ; x < s_EqTimeout ; x++)
+    for (x = 0 ; x < s_EqTimeout ; x++)
     {
         valueE = m_pinE.digitalRead();
         valueQ = m_pinQ.digitalRead();
@@ -282,6 +285,7 @@ C6809EClockMasterCpu::memoryReadWrite(
         m_pinClock.digitalWriteHIGH();
         m_pinClock.digitalWriteLOW();
     }
+    m_clockCount += x;
     CHECK_LITERAL_VALUE_EXIT(error, m_pinOut->m_E_i, valueE, LOW);
     CHECK_LITERAL_VALUE_EXIT(error, m_pinOut->m_Q_i, valueQ, LOW);
 
@@ -312,7 +316,7 @@ C6809EClockMasterCpu::memoryReadWrite(
     // - Wait for E-Lo, Q-Hi
     // - Q-rising
     //
-    for (int x = 0 ; x < s_EqTimeout ; x++)
+    for (x = 0 ; x < s_EqTimeout ; x++)
     {
         valueQ = m_pinQ.digitalRead();
 
@@ -324,6 +328,7 @@ C6809EClockMasterCpu::memoryReadWrite(
         m_pinClock.digitalWriteHIGH();
         m_pinClock.digitalWriteLOW();
     }
+    m_clockCount += x;
     CHECK_PIN_VALUE_EXIT(error, m_pinE, m_pinOut->m_E_i, LOW);
     CHECK_LITERAL_VALUE_EXIT(error, m_pinOut->m_Q_i, valueQ, HIGH);
 
@@ -337,7 +342,7 @@ C6809EClockMasterCpu::memoryReadWrite(
     // - Wait for E-Hi, Q-Hi
     // - E-rising
     //
-    for (int x = 0 ; x < s_EqTimeout ; x++)
+    for (x = 0 ; x < s_EqTimeout ; x++)
     {
         valueE = m_pinE.digitalRead();
 
@@ -349,6 +354,7 @@ C6809EClockMasterCpu::memoryReadWrite(
         m_pinClock.digitalWriteHIGH();
         m_pinClock.digitalWriteLOW();
     }
+    m_clockCount += x;
     CHECK_LITERAL_VALUE_EXIT(error, m_pinOut->m_E_i, valueE, HIGH);
     CHECK_PIN_VALUE_EXIT(error, m_pinQ, m_pinOut->m_Q_i, HIGH);
 
@@ -362,7 +368,7 @@ C6809EClockMasterCpu::memoryReadWrite(
     // - Wait for E-Hi, Q-Lo
     // - Q-falling
     //
-    for (int x = 0 ; x < s_EqTimeout ; x++)
+    for (x = 0 ; x < s_EqTimeout ; x++)
     {
         valueQ = m_pinQ.digitalRead();
 
@@ -374,6 +380,7 @@ C6809EClockMasterCpu::memoryReadWrite(
         m_pinClock.digitalWriteHIGH();
         m_pinClock.digitalWriteLOW();
     }
+    m_clockCount += x;
     CHECK_PIN_VALUE_EXIT(error, m_pinE, m_pinOut->m_E_i, HIGH);
     CHECK_LITERAL_VALUE_EXIT(error, m_pinOut->m_Q_i, valueQ, LOW);
 
@@ -382,7 +389,7 @@ C6809EClockMasterCpu::memoryReadWrite(
     // - Wait for E-Lo, Q-Lo
     // - E-falling
     //
-    for (int x = 0 ; x < s_EqTimeout ; x++)
+    for (x = 0 ; x < s_EqTimeout ; x++)
     {
         valueE = m_pinE.digitalRead();
 
@@ -409,6 +416,7 @@ C6809EClockMasterCpu::memoryReadWrite(
         m_pinClock.digitalWriteHIGH();
         m_pinClock.digitalWriteLOW();
     }
+    m_clockCount += x;
     CHECK_LITERAL_VALUE_EXIT(error, m_pinOut->m_E_i, valueE, LOW);
     CHECK_PIN_VALUE_EXIT(error, m_pinQ, m_pinOut->m_Q_i, LOW);
 
@@ -442,9 +450,10 @@ C6809EClockMasterCpu::memoryReadWrite(
     }
 
 Exit:
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
 
     return error;
@@ -457,6 +466,8 @@ C6809EClockMasterCpu::memoryRead(
     UINT16 *data
 )
 {
+    BUS_STATS_INC(reads);
+
     return memoryReadWrite(address, data, HIGH);
 }
 
@@ -467,6 +478,8 @@ C6809EClockMasterCpu::memoryWrite(
     UINT16 data
 )
 {
+    BUS_STATS_INC(writes);
+
     return memoryReadWrite(address, &data, LOW);
 }
 
@@ -546,6 +559,31 @@ C6809EClockMasterCpu::clockPulse(
 {
     m_pinClock.digitalWriteHIGH();
     m_pinClock.digitalWriteLOW();
+
+    m_clockCount++;
+}
+
+//
+// Pulse the clock pin 'count' times. The E & Q outputs of the 6809E are
+// derived by the board from the master clock so there's no state here to
+// keep in step and the whole run can go out as a single burst.
+//
+void
+C6809EClockMasterCpu::clockPulses(
+    UINT32 count
+)
+{
+    m_pinClock.digitalPulses(count);
+
+    m_clockCount += count;
+}
+
+
+UINT32
+C6809EClockMasterCpu::clockCount(
+)
+{
+    return m_clockCount;
 }
 
 
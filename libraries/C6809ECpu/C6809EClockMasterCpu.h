@@ -26,14 +26,14 @@
 #define C6809EClockMasterCpu_h
 
 #include "Arduino.h"
-#include "ICpu.h"
+#include "IClockMasterCpu.h"
 #include "CFastBus.h"
 #include "CFast8BitBus.h"
 #include "CFastPin.h"
 #include "C6809EPinOut.h"
 
 
-class C6809EClockMasterCpu : public ICpu
+class C6809EClockMasterCpu : public IClockMasterCpu
 {
     public:
 
@@ -103,13 +103,25 @@ class C6809EClockMasterCpu : public ICpu
         );
 
         //
-        // C6809EClockMasterCpu Interface
+        // IClockMasterCpu Interface
         //
 
+        virtual
         void
         clockPulse(
         );
 
+        virtual
+        void
+        clockPulses(
+            UINT32 count
+        );
+
+        virtual
+        UINT32
+        clockCount(
+        );
+
     private:
 
         PERROR
@@ -133,6 +145,8 @@ class C6809EClockMasterCpu : public ICpu
 
         CFastPin      m_pinClock;
 
+        UINT32        m_clockCount;
+
 };
 
 #endif
@@ -249,9 +249,15 @@ static PERROR CHyperSportsBaseGame::delayFunction(
     unsigned long startTime = millis();
     unsigned long endTime   = startTime + ms;
 
-    // Dummy read to run the clock
+    //
+    // Run the clock in fast bursts with the dummy read after each one to
+    // bring the clock back to the start of a cycle and to check that E & Q
+    // are still running. The bus is left on the 0xFFFF read between them.
+    //
     while (millis() < endTime)
     {
+        cpu->clockPulses(1024);
+
         error = cpu->memoryRead(0xFFFF, &data);
     }
 
@@ -324,7 +330,7 @@ CHyperSportsBaseGame::runClock1m(
 )
 {
     CHyperSportsBaseGame *thisGame  = (CHyperSportsBaseGame *) cHyperSportsBaseGame;
-    ICpu                 *cpu       = (ICpu *) thisGame->m_cpu;
+    ICpu                 *cpu       = (ICpu *) thisGame->cpu();
 
     return delayFunction(cpu, 60 * 1000UL);
 }
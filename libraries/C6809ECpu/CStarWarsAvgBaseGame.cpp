@@ -24,6 +24,7 @@
 //
 #include "CStarWarsAvgBaseGame.h"
 #include "C6809EClockMasterCpu.h"
+#include "CClockRun.h"
 
 //
 // Notes
@@ -45,6 +46,9 @@ static const UINT32 c_AVG_RST_A   = 0x4620;
 static const UINT32 c_AVG_HALT_A  = 0x4320;
 static const UINT32 c_AVG_HALT_D  = 0x40;
 
+// Longest the vector generator is run for to reach HALT (~87ms @ 12MHz).
+static const UINT32 c_runClockLimit = 0x100000;
+
 static const UINT32 c_VRAM_BASE   = 0x0000;
 static const UINT32 c_VRAM_LEN    = 0x3000;
 //
@@ -95,10 +99,93 @@ static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //
                                                             {CStarWarsAvgBaseGame::loadAll,                  "Load All  "},
                                                             {CStarWarsAvgBaseGame::vgGo,                     "VG Go     "},
                                                             {CStarWarsAvgBaseGame::capture32,                "Capture 32"},
+                                                            {CStarWarsAvgBaseGame::captureVcd,               "Cap VCD   "},
+                                                            {CStarWarsAvgBaseGame::captureBinary,            "Cap Binary"},
                                                             {CStarWarsAvgBaseGame::rstGoCap32,               "RstGoCap32"},
                                                             {CStarWarsAvgBaseGame::runToHalt,                "Run-Halt  "},
+                                                            {CStarWarsAvgBaseGame::sigNode,                  "Sig Node  "},
+                                                            {CStarWarsAvgBaseGame::signature,                "Signature "},
+                                                            {CStarWarsAvgBaseGame::capWalk,                  "Cap Walk  "},
                                                             {NO_CUSTOM_FUNCTION}}; // end of list
 
+//
+// Known good patterns of the AVG state machine nodes on AUX pin 1, from
+// StarWarsCaptures.txt. The window is the 32, 64 or 96 clocks that follow
+// the vector generator being started on a VCTR.
+//
+static const CAPTURE_NODE s_captureNode[] PROGMEM = { //                                                                                                                    "01"
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 32, {0xF0, 0xFF, 0xFF, 0xFF                                                }, "4H",  6}, // -LATCH1
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "4B",  1},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "4B",  2},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "4B",  3},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF                        }, "4B",  4},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF                        }, "4B",  5},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF                        }, "4B",  6},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF                        }, "4B",  7},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00                        }, "4B",  9},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00                        }, "4B", 10},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00                        }, "4B", 11},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00                        }, "4B", 12},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00                        }, "4B", 15},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 32, {0xFF, 0xF0, 0xFF, 0xFF                                                }, "3D",  1}, // -LATCH0
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF                        }, "3D",  2}, // -LATCH1
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 32, {0xFF, 0xFF, 0xFF, 0xF0                                                }, "3D",  3}, // -LATCH2
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 32, {0xFF, 0xFF, 0xF0, 0xFF                                                }, "3D",  4}, // -LATCH3
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0                        }, "3B",  9}, // state clock
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 96, {0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, "3D", 12}, // ST3
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF                        }, "1E", 11},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "1E", 12},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00                        }, "1E", 13},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E                        }, "2E",  1},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF                        }, "2E",  2},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF                        }, "2E",  3},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF                        }, "2E",  9}, // VCTR
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "2E", 10}, // CNTR
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF                        }, "2F", 13},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "2F", 12},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00                        }, "2F", 14},
+                                                        {CStarWarsAvgBaseGame::nodeStartVctr, 64, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF                        }, "1F", 13},
+                                                        };
+
+//
+// Known good signatures of the same nodes, kept apart from the patterns for
+// the same reasons as on the main board. Until measured on a known good board
+// they're the signatures of the patterns above over the same windows.
+//
+static const SIGNATURE_NODE s_signatureNode[] PROGMEM = { //                                               "01"
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 32, 0x79FD, "4H",  6}, // -LATCH1
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x0000, "4B",  1},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x0000, "4B",  2},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x0000, "4B",  3},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0xA4A7, "4B",  4},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x6B78, "4B",  5},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x229E, "4B",  6},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x7339, "4B",  7},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0xA7F2, "4B",  9},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x39AF, "4B", 10},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x9E78, "4B", 11},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x7891, "4B", 12},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0xA7F2, "4B", 15},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 32, 0x2011, "3D",  1}, // -LATCH0
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x49DB, "3D",  2}, // -LATCH1
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 32, 0x395E, "3D",  3}, // -LATCH2
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 32, 0x3648, "3D",  4}, // -LATCH3
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x3448, "3B",  9}, // state clock
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 96, 0xCC62, "3D", 12}, // ST3
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x00FE, "1E", 11},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x0000, "1E", 12},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0xA7F2, "1E", 13},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x2689, "2E",  1},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0xA815, "2E",  2},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0xA60E, "2E",  3},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x00FE, "2E",  9}, // VCTR
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x0000, "2E", 10}, // CNTR
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0xA70C, "2F", 13},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x0000, "2F", 12},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0x0102, "2F", 14},
+                                                          {CStarWarsAvgBaseGame::nodeStartVctr, 64, 0xA60E, "1F", 13},
+                                                          };
+
 
 CStarWarsAvgBaseGame::CStarWarsAvgBaseGame(
     const ROM_REGION    *romRegion
@@ -120,7 +207,8 @@ CStarWarsAvgBaseGame::CStarWarsAvgBaseGame(
     m_interruptAutoVector = false;
 
     // Signal capture extension
-    m_capture = new CCapture(m_cpu);
+    m_capture = new CCapture(m_cpu, s_captureNode, ARRAYSIZE(s_captureNode),
+                             s_signatureNode, ARRAYSIZE(s_signatureNode));
 
 }
 
@@ -147,7 +235,7 @@ CStarWarsAvgBaseGame::load(
 )
 {
     CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
-    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->m_cpu;
+    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->cpu();
     PERROR error = errorSuccess;
 
     // Load the vector RAM with test pattern
@@ -315,7 +403,7 @@ CStarWarsAvgBaseGame::vgRst(
 )
 {
     CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
-    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->m_cpu;
+    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->cpu();
     PERROR error = errorSuccess;
 
     // Reset the vector generator
@@ -334,7 +422,7 @@ CStarWarsAvgBaseGame::vgGo(
 )
 {
     CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
-    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->m_cpu;
+    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->cpu();
     PERROR error = errorSuccess;
 
     // Poke the vector generator to run
@@ -358,6 +446,100 @@ CStarWarsAvgBaseGame::capture32(
 }
 
 
+// Run the default deep capture and stream it out as VCD
+PERROR
+CStarWarsAvgBaseGame::captureVcd(
+    void   *context
+)
+{
+    CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
+
+    return thisGame->m_capture->captureDeep(CCapture::VCD);
+}
+
+
+// Run the default deep capture and stream it out in the compact binary form
+PERROR
+CStarWarsAvgBaseGame::captureBinary(
+    void   *context
+)
+{
+    CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
+
+    return thisGame->m_capture->captureDeep(CCapture::BINARY);
+}
+
+
+// Step to the next signature node to probe
+PERROR
+CStarWarsAvgBaseGame::sigNode(
+    void   *context
+)
+{
+    CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
+
+    return thisGame->m_capture->signatureNodeNext();
+}
+
+
+// Run the window of the current node and check its signature
+PERROR
+CStarWarsAvgBaseGame::signature(
+    void   *context
+)
+{
+    CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
+
+    return thisGame->m_capture->signatureNodeCheck(context);
+}
+
+
+// Capture the current node against its pattern and move on to the next
+PERROR
+CStarWarsAvgBaseGame::capWalk(
+    void   *context
+)
+{
+    CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
+
+    return thisGame->m_capture->nodeWalk(context);
+}
+
+
+// VG Rst then Load VCTR then VG Rst & VG Go, the same as the capture sequence
+PERROR
+CStarWarsAvgBaseGame::nodeStartVctr(
+    void   *context
+)
+{
+    CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
+    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->cpu();
+    PERROR error = errorSuccess;
+
+    error = vgRst(context);
+
+    if (SUCCESS(error))
+    {
+        error = loadVCTR(context);
+    }
+
+    if (FAILED(error))
+    {
+        goto Exit;
+    }
+
+    // Reset the vector generator
+    CHECK_CPU_WRITE_EXIT(error, cpu, c_AVG_RST_A, 0);
+
+    // Poke the vector generator to run
+    CHECK_CPU_WRITE_EXIT(error, cpu, c_AVG_GO_A, 0);
+
+Exit:
+
+    return error;
+}
+
+
 // VG Rst then VG Go then Capture 32
 PERROR
 CStarWarsAvgBaseGame::rstGoCap32(
@@ -365,7 +547,7 @@ CStarWarsAvgBaseGame::rstGoCap32(
 )
 {
     CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
-    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->m_cpu;
+    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->cpu();
     PERROR error = errorSuccess;
 
     // Reset the vector generator
@@ -382,33 +564,35 @@ Exit:
 }
 
 
-// Run the vector generator until it halts
+//
+// Run the vector generator until it halts and show the number of master
+// clocks it took. The HALT status is read back to back so the count is
+// within one bus cycle of the actual halt.
+//
 PERROR
 CStarWarsAvgBaseGame::runToHalt(
     void   *context
 )
 {
     CStarWarsAvgBaseGame *thisGame = (CStarWarsAvgBaseGame *) context;
-    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->m_cpu;
-    UINT16 recData;
-    UINT32 cycleCount = 0;
+    CClockRun clockRun((IClockMasterCpu *) thisGame->cpu());
+    UINT32 clocks = 0;
     PERROR error = errorSuccess;
 
-    // The CPU reads for HALT status will run the system clock
-    do
+    error = clockRun.runToStatus( c_AVG_HALT_A,
+                                  c_AVG_HALT_D,
+                                  c_AVG_HALT_D,
+                                  0,
+                                  c_runClockLimit,
+                                  &clocks );
+
+    if (SUCCESS(error))
     {
-        CHECK_CPU_READ_EXIT(error, cpu, c_AVG_HALT_A, &recData);
-        cycleCount++;
+        error = errorCustom;
+        error->code = ERROR_SUCCESS;
+        stringCopy(error->description, "OK: Clk ");
+        stringAppendDec(error->description, clocks);
     }
-    while (!(recData & c_AVG_HALT_D));
-
-    // Print out how long it took
-    error = errorCustom;
-    error->code = ERROR_SUCCESS;
-    error->description = "OK: ";
-    STRING_UINT32_HEX(error->description, cycleCount);
-
-Exit:
 
     return error;
 }
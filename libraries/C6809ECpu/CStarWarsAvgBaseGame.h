@@ -72,10 +72,34 @@ class CStarWarsAvgBaseGame : public CGame
             void *context
         );
 
+        static PERROR captureVcd(
+            void *context
+        );
+
+        static PERROR captureBinary(
+            void *context
+        );
+
         static PERROR rstGoCap32(
             void *context
         );
 
+        static PERROR sigNode(
+            void *context
+        );
+
+        static PERROR signature(
+            void *context
+        );
+
+        static PERROR capWalk(
+            void *context
+        );
+
+        static PERROR nodeStartVctr(
+            void *context
+        );
+
         static PERROR runToHalt(
             void *context
         );
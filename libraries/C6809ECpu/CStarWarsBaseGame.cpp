@@ -24,6 +24,9 @@
 //
 #include "CStarWarsBaseGame.h"
 #include "C6809EClockMasterCpu.h"
+#include "CClockRun.h"
+#include "PinMap.h"
+#include "CScheduler.h"
 
 //
 // Notes
@@ -70,6 +73,26 @@ static const UINT32 c_MW0_A    = 0x4700; // Matrix Write 0 (Program Address MPA2
 static const UINT32 c_MW1_A    = 0x4701; // Matrix Write 1 (Block Index Hi BIC8)
 static const UINT32 c_MW2_A    = 0x4702; // Matrix Write 2 (Block Index Lo BIC0-BIC7)
 
+// Number of vectors run for each of the MX Smoke forms & the fixed seed
+// that makes the vectors the same on every run.
+static const UINT16 c_mxSmokeVectors = 1024;
+static const long   c_mxSmokeSeed    = 0x5357;
+
+// Clocks to run for a divide in the sweep. The divider is done by clock ~61
+// in the known good capture of -REN and so this leaves some margin.
+static const UINT32 c_dvSweepClocks = 96;
+
+// Number of random operand pairs in the divider sweep & the fixed seed.
+static const UINT16 c_dvSweepRandom = 4096;
+static const long   c_dvSweepSeed   = 0x4456;
+
+// Largest dividend & divisor in the sweep, the largest operand the fixed
+// divider tests 21 to 25 check the quotient model against.
+static const UINT16 c_dvSweepLimit = 0x5555;
+
+// Longest a repeated matrix program or divide is run for when timing it.
+static const UINT32 c_runClockLimit = 0x10000;
+
 // ADC
 static const UINT32 c_ADC_A       = 0x4380; // ADC read address
 
@@ -140,17 +163,103 @@ static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //
                                                             {CStarWarsBaseGame::test18,                      "MX Test 18"},
                                                             {CStarWarsBaseGame::test19,                      "MX Test 19"},
                                                             {CStarWarsBaseGame::test20,                      "MX Test 20"},
+                                                            {CStarWarsBaseGame::mxSmoke,                     "MX Smoke  "},
                                                             {CStarWarsBaseGame::test21,                      "DV Test 21"},
                                                             {CStarWarsBaseGame::test22,                      "DV Test 22"},
                                                             {CStarWarsBaseGame::test23,                      "DV Test 23"},
                                                             {CStarWarsBaseGame::test24,                      "DV Test 24"},
                                                             {CStarWarsBaseGame::test25,                      "DV Test 25"},
+                                                            {CStarWarsBaseGame::dvSweep,                     "DV Sweep  "},
                                                             {CStarWarsBaseGame::repeatLastMatrixProgram,     "Repeat MX "},
                                                             {CStarWarsBaseGame::repeatLastDividerProgram,    "Repeat DV "},
+                                                            {CStarWarsBaseGame::runMatrix,                   "Run-MX    "},
+                                                            {CStarWarsBaseGame::runDivider,                  "Run-DV    "},
                                                             {CStarWarsBaseGame::clockPulse,                  "Clk Pulse "},
                                                             {CStarWarsBaseGame::capture32,                   "Capture 32"},
+                                                            {CStarWarsBaseGame::captureVcd,                  "Cap VCD   "},
+                                                            {CStarWarsBaseGame::captureBinary,               "Cap Binary"},
+                                                            {CStarWarsBaseGame::sigNode,                     "Sig Node  "},
+                                                            {CStarWarsBaseGame::signature,                   "Signature "},
+                                                            {CStarWarsBaseGame::capWalk,                     "Cap Walk  "},
                                                             {NO_CUSTOM_FUNCTION}}; // end of list
 
+//
+// Known good patterns of the math box & divider nodes on AUX pin 1, from
+// StarWarsCaptures.txt. The window is the captures that follow the test
+// & repeat.
+//
+static const CAPTURE_NODE s_captureNode[] PROGMEM = { //                                                                                                                 "01"
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF                        }, "8B",  1},
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0x00, 0x00, 0x00, 0x02, 0xAA, 0xA8, 0x00, 0x00                        }, "8B",  6},
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "8B",  7},
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00, 0x00                        }, "8B",  9},
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0x00, 0x01, 0x55, 0x54, 0x00, 0x00, 0x00, 0x00                        }, "8B", 12},
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "8B", 14},
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0x1F, 0xFE, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00                        }, "8B", 15},
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0x1F, 0xFE, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "7A", 10},
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "7B",  9},
+                                                        {CStarWarsBaseGame::nodeStartMx17, 64, {0x1F, 0xFE, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "6A",  9},
+                                                        {CStarWarsBaseGame::nodeStartMx18, 64, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                        }, "7A",  9},
+                                                        {CStarWarsBaseGame::nodeStartMx18, 64, {0x00, 0xFE, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00                        }, "7B",  9},
+                                                        {CStarWarsBaseGame::nodeStartDv21, 96, {0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, "7P",  6}, // -STP
+                                                        {CStarWarsBaseGame::nodeStartDv21, 96, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF}, "8P",  7}, // -REN
+                                                        {CStarWarsBaseGame::nodeStartDv21, 96, {0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x00, 0x00, 0x00, 0x00}, "8P", 10}, // 3MHz*
+                                                        {CStarWarsBaseGame::nodeStartDv21, 96, {0xE6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0xFF, 0xFF, 0xFF, 0xFF}, "8P",  9}, // -3MHz*
+                                                        {CStarWarsBaseGame::nodeStartDv21, 96, {0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, "6R",  9}, // CIG*
+                                                        {CStarWarsBaseGame::nodeStartDv21, 96, {0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, "3M",  3}, // DS0
+                                                        {CStarWarsBaseGame::nodeStartDv21, 96, {0x19, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x00, 0x00, 0x00, 0x00}, "8N",  8}, // DS1
+                                                        };
+
+//
+// Known good signatures of the same nodes. They're kept apart from the
+// patterns so a window isn't limited to the 96 clocks a pattern can hold, and
+// so a signature measured on a known good board can replace one that's only
+// as good as its documented pattern. Until then they're the signatures of the
+// patterns above over the same windows.
+//
+static const SIGNATURE_NODE s_signatureNode[] PROGMEM = { //                                            "01"
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x3D78, "8B",  1},
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x170E, "8B",  6},
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x0000, "8B",  7},
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x0B87, "8B",  9},
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x7EB2, "8B", 12},
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x0000, "8B", 14},
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x0F16, "8B", 15},
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x30D4, "7A", 10},
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x0000, "7B",  9},
+                                                          {CStarWarsBaseGame::nodeStartMx17, 64, 0x30D4, "6A",  9},
+                                                          {CStarWarsBaseGame::nodeStartMx18, 64, 0x0000, "7A",  9},
+                                                          {CStarWarsBaseGame::nodeStartMx18, 64, 0x3F50, "7B",  9},
+                                                          {CStarWarsBaseGame::nodeStartDv21, 96, 0xD2D8, "7P",  6}, // -STP
+                                                          {CStarWarsBaseGame::nodeStartDv21, 96, 0xCA8A, "8P",  7}, // -REN
+                                                          {CStarWarsBaseGame::nodeStartDv21, 96, 0x07EF, "8P", 10}, //  3MHz*
+                                                          {CStarWarsBaseGame::nodeStartDv21, 96, 0xA25E, "8P",  9}, // -3MHz*
+                                                          {CStarWarsBaseGame::nodeStartDv21, 96, 0xAFFD, "6R",  9}, //  CIG*
+                                                          {CStarWarsBaseGame::nodeStartDv21, 96, 0xD99B, "3M",  3}, //  DS0
+                                                          {CStarWarsBaseGame::nodeStartDv21, 96, 0x07EF, "8N",  8}, //  DS1
+                                                        };
+
+//
+// The forms of the MX Smoke vectors. This is a smoke test of the MB RAM, the
+// program start & the sequencer running a program to completion, not of the
+// datapath arithmetic. There are no dumps of the math box sequencer PROMs in
+// the tree so no multiply or accumulate result can be computed here. Every
+// form is one where the random word written to the data address comes back
+// unchanged at the result address, as the fixed tests show.
+//
+// 0x170 copies word 0x00 to 0x01 (tests 15 & 16 have every bit both ways).
+// 0x174 computes word 0x00 from 0x0C, 0x0D & the 2.14 scale in 0x0E, so with
+//       one input zero & a scale of +/-1.0 the other input comes back as is
+//       (tests 17 to 20). Those tests only use positive inputs below 0x8000
+//       so the random words are masked to that range. Negative inputs and
+//       the overflow of the scaled sum aren't known without the PROMs.
+//
+static const MX_SMOKE_FORM s_mxSmokeForm[] PROGMEM = {
+                                                           {0x170, 0x00, 0x00, 0x00, 0x0000, 0x01, 0xFFFF},
+                                                           {0x174, 0x0C, 0x0D, 0x0E, 0x4000, 0x00, 0x7FFF},
+                                                           {0x174, 0x0D, 0x0C, 0x0E, 0xC000, 0x00, 0x7FFF},
+                                                         };
+
 
 CStarWarsBaseGame::CStarWarsBaseGame(
     const ROM_REGION    *romRegion
@@ -176,7 +285,8 @@ CStarWarsBaseGame::CStarWarsBaseGame(
     m_interruptAutoVector = false;
 
     // Signal capture extension
-    m_capture = new CCapture(m_cpu);
+    m_capture = new CCapture(m_cpu, s_captureNode, ARRAYSIZE(s_captureNode),
+                             s_signatureNode, ARRAYSIZE(s_signatureNode));
 
 }
 
@@ -253,7 +363,7 @@ CStarWarsBaseGame::waitForMathRunLo(
     {
         error = errorCustom;
         error->code = ERROR_FAILED;
-        error->description = "E: MATH RUN Hi";
+        stringCopy(error->description, "E: MATH RUN Hi");
     }
 
 Exit:
@@ -289,15 +399,15 @@ CStarWarsBaseGame::testMatrix(
     // Load the source data words
     for (int x = 0 ; x < srcDataLength ; x++)
     {
-        CHECK_CPU_WRITE_EXIT(error, cpu, c_MBRAM_A + (srcDataAddress[x] << 1) | 0, (srcData[x] >> 8) & 0xFF);
-        CHECK_CPU_WRITE_EXIT(error, cpu, c_MBRAM_A + (srcDataAddress[x] << 1) | 1, (srcData[x] >> 0) & 0xFF);
+        CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (srcDataAddress[x] << 1)) | 0, (srcData[x] >> 8) & 0xFF);
+        CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (srcDataAddress[x] << 1)) | 1, (srcData[x] >> 0) & 0xFF);
     }
 
     // Make sure the result words are set to something so we know something happened
     for (int x = 0 ; x < expDataLength ; x++)
     {
-        CHECK_CPU_WRITE_EXIT(error, cpu, c_MBRAM_A + (expDataAddress[x] << 1) | 0, 0x12);
-        CHECK_CPU_WRITE_EXIT(error, cpu, c_MBRAM_A + (expDataAddress[x] << 1) | 1, 0x34);
+        CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (expDataAddress[x] << 1)) | 0, 0x12);
+        CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (expDataAddress[x] << 1)) | 1, 0x34);
     }
 
     // Write the program address to start
@@ -317,9 +427,9 @@ CStarWarsBaseGame::testMatrix(
     {
         recResult = 0;
 
-        CHECK_CPU_READ_EXIT(error, cpu, c_MBRAM_A + (expDataAddress[x] << 1) | 0, &recData);
+        CHECK_CPU_READ_EXIT(error, cpu, (c_MBRAM_A + (expDataAddress[x] << 1)) | 0, &recData);
         recResult |= (recData << 8);
-        CHECK_CPU_READ_EXIT(error, cpu, c_MBRAM_A + (expDataAddress[x] << 1) | 1, &recData);
+        CHECK_CPU_READ_EXIT(error, cpu, (c_MBRAM_A + (expDataAddress[x] << 1)) | 1, &recData);
         recResult |= (recData << 0);
 
         CHECK_UINT16_VALUE_EXIT(error, "MX", recResult, expData[x]);
@@ -391,7 +501,7 @@ CStarWarsBaseGame::testADC(
 )
 {
     CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
-    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->m_cpu;
+    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->cpu();
     PERROR error = errorSuccess;
     UINT16 data[4] = {0,0,0,0};
 
@@ -407,17 +517,14 @@ CStarWarsBaseGame::testADC(
         //  12MHz === 83.33ns
         //  116us/83.33ns = 1,392 clock pulses.
         //
-        for (int x = 0 ; x < 1392 ; x++)
-        {
-            cpu->clockPulse();
-        }
+        cpu->clockPulses(1392);
 
         CHECK_CPU_READ_EXIT(error, cpu, c_ADC_A, &data[channel]);
     }
 
     error = errorCustom;
     error->code = ERROR_SUCCESS;
-    error->description = "OK: ";
+    stringCopy(error->description, "OK: ");
 
     for (int byte = 0 ; byte < 4 ; byte++)
     {
@@ -590,6 +697,122 @@ CStarWarsBaseGame::test20(
 }
 
 
+//
+// Run the random vectors of each form back to back. A pass shows the MB RAM
+// holds random words and the programs start & finish. A multiplier or adder
+// fault that leaves the +/-1.0 pass-through intact isn't caught.
+//
+// Unlike testMatrix the result word isn't preset before every vector - the
+// random word is never the same as the one before it so a program that didn't
+// run still fails. On a failure the vector number is left in the error detail
+// address.
+//
+PERROR
+CStarWarsBaseGame::mxSmoke(
+    void   *context
+)
+{
+    CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
+    ICpu *cpu = thisGame->m_cpu;
+    PERROR error = errorSuccess;
+    UINT32 vector = 0;
+    UINT16 recData;
+
+    randomSeed(c_mxSmokeSeed);
+
+    // Make sure the matrix processor is idle
+    error = thisGame->waitForMathRunLo();
+    if (FAILED(error))
+    {
+        goto Exit;
+    }
+
+    for (UINT8 index = 0 ; index < ARRAYSIZE(s_mxSmokeForm) ; index++)
+    {
+        MX_SMOKE_FORM form;
+        UINT16 lastData;
+
+        memcpy_P(&form, &s_mxSmokeForm[index], sizeof(form));
+
+        // Preset the result to something other than the first random word.
+        lastData = (UINT16) random(0x10000);
+        CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (form.resultAddress << 1)) | 0, (lastData >> 8) & 0xFF);
+        CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (form.resultAddress << 1)) | 1, (lastData >> 0) & 0xFF);
+
+        for (UINT16 count = 0 ; count < c_mxSmokeVectors ; count++, vector++)
+        {
+            UINT16 data;
+            UINT16 recResult = 0;
+
+            do
+            {
+                data = (UINT16) random(0x10000) & form.dataMask;
+            }
+            while (data == lastData);
+
+            lastData = data;
+
+            CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (form.dataAddress << 1)) | 0, (data >> 8) & 0xFF);
+            CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (form.dataAddress << 1)) | 1, (data >> 0) & 0xFF);
+
+            // The inputs are rewritten as the program may use them as scratch.
+            if (form.scaleAddress != 0x00)
+            {
+                CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (form.zeroAddress  << 1)) | 0, 0x00);
+                CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (form.zeroAddress  << 1)) | 1, 0x00);
+                CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (form.scaleAddress << 1)) | 0, (form.scale >> 8) & 0xFF);
+                CHECK_CPU_WRITE_EXIT(error, cpu, (c_MBRAM_A + (form.scaleAddress << 1)) | 1, (form.scale >> 0) & 0xFF);
+            }
+
+            CHECK_CPU_WRITE_EXIT(error, cpu, c_MW0_A, (form.programAddress >> 2) & 0xFF);
+
+            error = thisGame->waitForMathRunLo();
+            if (FAILED(error))
+            {
+                goto Exit;
+            }
+
+            CHECK_CPU_READ_EXIT(error, cpu, (c_MBRAM_A + (form.resultAddress << 1)) | 0, &recData);
+            recResult |= (recData << 8);
+            CHECK_CPU_READ_EXIT(error, cpu, (c_MBRAM_A + (form.resultAddress << 1)) | 1, &recData);
+            recResult |= (recData << 0);
+
+            if (recResult != data)
+            {
+                error = errorCustom;
+                error->code = ERROR_FAILED;
+                stringCopy(error->description, "E:MX");
+                STRING_UINT16_HEX(error->description, data);
+                STRING_UINT16_HEX(error->description, recResult);
+
+                errorDetail.address  = vector;
+                errorDetail.expected = data;
+                errorDetail.received = recResult;
+                goto Exit;
+            }
+
+            if ((count % 64) == 63)
+            {
+                YIELD_CHECK_ABORT_BREAK(error);
+            }
+        }
+
+        if (FAILED(error))
+        {
+            goto Exit;
+        }
+    }
+
+    error = errorCustom;
+    error->code = ERROR_SUCCESS;
+    stringCopy(error->description, "OK: Vec ");
+    stringAppendDec(error->description, vector);
+
+Exit:
+    return error;
+}
+
+
 PERROR
 CStarWarsBaseGame::test21(
     void   *context
@@ -635,6 +858,254 @@ CStarWarsBaseGame::test25(
 }
 
 
+//
+// Sweep the divider through the operand sets below, computing each expected
+// quotient on the fly. The sweep stops on the first failure showing the
+// operands & the highest failing quotient bit, and the divide is left set up
+// for "Repeat DV" and "Run-DV" to loop on it.
+//
+// The operands are 2.14 values, 1.0 being 0x4000. The dividend is kept below
+// twice the divisor so the quotient fits the 15 bit result, and both are kept
+// to at most c_dvSweepLimit, the range the fixed tests prove the model over.
+//
+PERROR
+CStarWarsBaseGame::dvSweep(
+    void   *context
+)
+{
+    CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
+    PERROR error = errorSuccess;
+    UINT32 lastDividend = 0xFFFFFFFF;
+    UINT32 count = 0;
+
+    static const UINT16 c_boundaryDivisor[] = {0x0001, 0x0002, 0x2AAA, 0x4000, 0x5555};
+
+    // Walking 1 through the dividend, alone & on top of 1.0, over a divisor of 1.0.
+    for (UINT8 bit = 0 ; bit < 15 ; bit++)
+    {
+        UINT16 walk = (1 << bit);
+
+        error = thisGame->sweepDivider(walk, 0x4000, &lastDividend);
+        if (FAILED(error))
+        {
+            goto Exit;
+        }
+
+        count++;
+
+        if ((walk | 0x4000) > c_dvSweepLimit)
+        {
+            continue;
+        }
+
+        error = thisGame->sweepDivider(walk | 0x4000, 0x4000, &lastDividend);
+        if (FAILED(error))
+        {
+            goto Exit;
+        }
+
+        count++;
+    }
+
+    // Walking 1 through the divisor with the smallest & largest non-zero quotients
+    // that the limit allows.
+    for (UINT8 bit = 0 ; bit < 15 ; bit++)
+    {
+        UINT16 walk = (1 << bit);
+        UINT16 largest = (walk << 1) - 1;
+
+        error = thisGame->sweepDivider(walk, walk, &lastDividend);
+        if (FAILED(error))
+        {
+            goto Exit;
+        }
+
+        count++;
+
+        if (largest > c_dvSweepLimit)
+        {
+            largest = c_dvSweepLimit;
+        }
+
+        error = thisGame->sweepDivider(largest, walk, &lastDividend);
+        if (FAILED(error))
+        {
+            goto Exit;
+        }
+
+        count++;
+    }
+
+    // Either side of the points where the quotient changes its top bits.
+    for (UINT8 index = 0 ; index < ARRAYSIZE(c_boundaryDivisor) ; index++)
+    {
+        UINT32 divisor = c_boundaryDivisor[index];
+        UINT32 dividend[] = {0, 1, divisor - 1, divisor, divisor + 1, (divisor << 1) - 1};
+
+        for (UINT8 entry = 0 ; entry < ARRAYSIZE(dividend) ; entry++)
+        {
+            if ((dividend[entry] >= (divisor << 1)) ||
+                (dividend[entry] > c_dvSweepLimit))
+            {
+                continue;
+            }
+
+            error = thisGame->sweepDivider((UINT16) dividend[entry], (UINT16) divisor, &lastDividend);
+            if (FAILED(error))
+            {
+                goto Exit;
+            }
+
+            count++;
+        }
+    }
+
+    randomSeed(c_dvSweepSeed);
+
+    for (UINT16 pair = 0 ; pair < c_dvSweepRandom ; pair++)
+    {
+        UINT32 divisor  = (UINT32) random(1, (UINT32) c_dvSweepLimit + 1);
+        UINT32 dividendEnd = (divisor << 1);
+
+        if (dividendEnd > ((UINT32) c_dvSweepLimit + 1))
+        {
+            dividendEnd = (UINT32) c_dvSweepLimit + 1;
+        }
+
+        UINT32 dividend = (UINT32) random(0, dividendEnd);
+
+        error = thisGame->sweepDivider((UINT16) dividend, (UINT16) divisor, &lastDividend);
+        if (FAILED(error))
+        {
+            goto Exit;
+        }
+
+        count++;
+
+        if ((pair % 256) == 255)
+        {
+            YIELD_CHECK_ABORT_BREAK(error);
+        }
+    }
+
+    if (FAILED(error))
+    {
+        goto Exit;
+    }
+
+    error = errorCustom;
+    error->code = ERROR_SUCCESS;
+    stringCopy(error->description, "OK: Div ");
+    stringAppendDec(error->description, count);
+
+Exit:
+    return error;
+}
+
+
+//
+// The divider is a 15 step shift & subtract, one quotient bit per step from
+// Q14 down to Q0, i.e. (dividend << 14) / divisor for the operands the sweep
+// uses.
+//
+UINT16
+CStarWarsBaseGame::dividerQuotient(
+    UINT16 dividend,
+    UINT16 divisor
+)
+{
+    UINT32 remainder = dividend;
+    UINT16 quotient = 0;
+
+    for (UINT8 step = 0 ; step < 15 ; step++)
+    {
+        quotient <<= 1;
+
+        if (remainder >= divisor)
+        {
+            remainder -= divisor;
+            quotient  |= 1;
+        }
+
+        remainder <<= 1;
+    }
+
+    return quotient;
+}
+
+
+//
+// Run one divide of the sweep. The dividend latch holds its value between
+// divides so only the bytes that changed are written, and the divide is
+// then run with a burst of master clocks rather than dummy bus cycles.
+//
+PERROR
+CStarWarsBaseGame::sweepDivider(
+    UINT16  dividend,
+    UINT16  divisor,
+    UINT32 *lastDividend
+)
+{
+    IClockMasterCpu *cpu = (IClockMasterCpu *) this->cpu();
+    PERROR error = errorSuccess;
+    UINT16 expQuotient = dividerQuotient(dividend, divisor);
+    UINT16 recQuotient = 0;
+    UINT16 recData;
+
+    if ((*lastDividend >> 8) != (UINT32) (dividend >> 8))
+    {
+        CHECK_CPU_WRITE_EXIT(error, cpu, c_DVDDH_A, (dividend >> 8) & 0xFF);
+    }
+
+    if ((*lastDividend & 0xFF) != (UINT32) (dividend & 0xFF))
+    {
+        CHECK_CPU_WRITE_EXIT(error, cpu, c_DVDDL_A, (dividend >> 0) & 0xFF);
+    }
+
+    *lastDividend = dividend;
+
+    m_lastDivisorDataHi = (divisor >> 8) & 0xFF;
+    m_lastDivisorDataLo = (divisor >> 0) & 0xFF;
+
+    CHECK_CPU_WRITE_EXIT(error, cpu, c_DVSRH_A, m_lastDivisorDataHi);
+    CHECK_CPU_WRITE_EXIT(error, cpu, c_DVSRL_A, m_lastDivisorDataLo);
+
+    cpu->clockPulses(c_dvSweepClocks);
+
+    CHECK_CPU_READ_EXIT(error, cpu, c_REH_A, &recData);
+    recQuotient |= (recData << 8);
+    CHECK_CPU_READ_EXIT(error, cpu, c_REL_A, &recData);
+    recQuotient |= (recData << 0);
+
+    if (recQuotient != expQuotient)
+    {
+        UINT16 difference = recQuotient ^ expQuotient;
+        UINT8 bit = 15;
+
+        while ((difference & (1 << bit)) == 0)
+        {
+            bit--;
+        }
+
+        error = errorCustom;
+        error->code = ERROR_FAILED;
+        stringCopy(error->description, "E:");
+        stringAppendHex(error->description, dividend, 4);
+        stringAppend(error->description, "/");
+        stringAppendHex(error->description, divisor, 4);
+        stringAppend(error->description, " Q");
+        stringAppendDec(error->description, bit);
+
+        errorDetail.address  = ((UINT32) dividend << 16) | divisor;
+        errorDetail.expected = expQuotient;
+        errorDetail.received = recQuotient;
+    }
+
+Exit:
+    return error;
+}
+
+
 PERROR
 CStarWarsBaseGame::repeatLastMatrixProgram(
     void   *context
@@ -679,21 +1150,107 @@ Exit:
 }
 
 
+//
+// Repeat the last matrix program and count the master clocks until MATH RUN
+// drops. MATH RUN is read back to back so the count is within one bus cycle.
+//
+PERROR
+CStarWarsBaseGame::runMatrix(
+    void   *context
+)
+{
+    CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
+    CClockRun clockRun((IClockMasterCpu *) thisGame->cpu());
+    UINT32 clocks = 0;
+    PERROR error = errorSuccess;
+
+    error = repeatLastMatrixProgram(context);
+    if (FAILED(error))
+    {
+        goto Exit;
+    }
+
+    error = clockRun.runToStatus( c_MBRUN_A,
+                                  c_MBRUN_D,
+                                  0x00,
+                                  0,
+                                  c_runClockLimit,
+                                  &clocks );
+    if (FAILED(error))
+    {
+        goto Exit;
+    }
+
+    error = errorCustom;
+    error->code = ERROR_SUCCESS;
+    stringCopy(error->description, "OK: Clk ");
+    stringAppendDec(error->description, clocks);
+
+Exit:
+    return error;
+}
+
+
+//
+// The divider has no status the CPU can read so the end of the divide is
+// found with the AUX 1 probe on a node that changes when it completes, e.g.
+// the ripple carry of the 8R counter. The count is to the exact clock the
+// probed node changed on.
+//
+PERROR
+CStarWarsBaseGame::runDivider(
+    void   *context
+)
+{
+    CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
+    CClockRun clockRun((IClockMasterCpu *) thisGame->cpu());
+    UINT32 clocks = 0;
+    PERROR error = errorSuccess;
+    int level;
+
+    error = repeatLastDividerProgram(context);
+    if (FAILED(error))
+    {
+        goto Exit;
+    }
+
+    ::pinMode(g_pinMap8Aux[1], INPUT);
+    level = ::digitalRead(g_pinMap8Aux[1]);
+
+    error = clockRun.runToAuxPin( 1,
+                                  (level == HIGH) ? LOW : HIGH,
+                                  c_runClockLimit,
+                                  &clocks );
+    if (FAILED(error))
+    {
+        goto Exit;
+    }
+
+    error = errorCustom;
+    error->code = ERROR_SUCCESS;
+    stringCopy(error->description, "OK: Clk ");
+    stringAppendDec(error->description, clocks);
+
+Exit:
+    return error;
+}
+
+
 PERROR
 CStarWarsBaseGame::clockPulse(
     void   *context
 )
 {
     CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
-    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->m_cpu;
+    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) thisGame->cpu();
     PERROR error = errorCustom;
 
     cpu->clockPulse();
     thisGame->m_clockPulseCount++;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "OK: Count ";
-    errorCustom->description += String(thisGame->m_clockPulseCount, DEC);
+    stringCopy(errorCustom->description, "OK: Count ");
+    stringAppendDec(errorCustom->description, thisGame->m_clockPulseCount);
 
     return error;
 }
@@ -710,3 +1267,100 @@ CStarWarsBaseGame::capture32(
     return thisGame->m_capture->capture32();
 }
 
+
+// Run the default deep capture and stream it out as VCD
+PERROR
+CStarWarsBaseGame::captureVcd(
+    void   *context
+)
+{
+    CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
+
+    return thisGame->m_capture->captureDeep(CCapture::VCD);
+}
+
+
+// Run the default deep capture and stream it out in the compact binary form
+PERROR
+CStarWarsBaseGame::captureBinary(
+    void   *context
+)
+{
+    CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
+
+    return thisGame->m_capture->captureDeep(CCapture::BINARY);
+}
+
+
+// Step to the next signature node to probe
+PERROR
+CStarWarsBaseGame::sigNode(
+    void   *context
+)
+{
+    CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
+
+    return thisGame->m_capture->signatureNodeNext();
+}
+
+
+// Run the window of the current node and check its signature
+PERROR
+CStarWarsBaseGame::signature(
+    void   *context
+)
+{
+    CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
+
+    return thisGame->m_capture->signatureNodeCheck(context);
+}
+
+
+// Capture the current node against its pattern and move on to the next
+PERROR
+CStarWarsBaseGame::capWalk(
+    void   *context
+)
+{
+    CStarWarsBaseGame *thisGame = (CStarWarsBaseGame *) context;
+
+    return thisGame->m_capture->nodeWalk(context);
+}
+
+
+//
+// The test result is ignored, the signatures are most use on a board that
+// fails the test. It's only run to set up the program that's repeated.
+//
+PERROR
+CStarWarsBaseGame::nodeStartMx17(
+    void   *context
+)
+{
+    test17(context);
+
+    return repeatLastMatrixProgram(context);
+}
+
+
+PERROR
+CStarWarsBaseGame::nodeStartMx18(
+    void   *context
+)
+{
+    test18(context);
+
+    return repeatLastMatrixProgram(context);
+}
+
+
+PERROR
+CStarWarsBaseGame::nodeStartDv21(
+    void   *context
+)
+{
+    test21(context);
+
+    return repeatLastDividerProgram(context);
+}
+
@@ -29,6 +29,22 @@
 #include "CCapture.h"
 
 
+//
+// One form of the MX Smoke matrix processor vectors. The word addresses are
+// MB RAM word offsets.
+//
+typedef struct _MX_SMOKE_FORM {
+
+    UINT16 programAddress;  // The program start address written to MW0.
+    UINT8  dataAddress;     // Where the random word is written.
+    UINT8  zeroAddress;     // Another input written as zero, with the scale.
+    UINT8  scaleAddress;    // The scale word, or 0x00 for programs without one.
+    UINT16 scale;
+    UINT8  resultAddress;   // Where the random word should come back.
+    UINT16 dataMask;        // Limits the random word to the range the fixed tests prove.
+
+} MX_SMOKE_FORM;
+
 class CStarWarsBaseGame : public CGame
 {
     public:
@@ -96,6 +112,10 @@ class CStarWarsBaseGame : public CGame
             void   *context
         );
 
+        static PERROR mxSmoke(
+            void   *context
+        );
+
         static PERROR test21(
             void   *context
         );
@@ -116,6 +136,10 @@ class CStarWarsBaseGame : public CGame
             void   *context
         );
 
+        static PERROR dvSweep(
+            void   *context
+        );
+
         static PERROR repeatLastMatrixProgram(
             void   *context
         );
@@ -124,6 +148,14 @@ class CStarWarsBaseGame : public CGame
             void   *context
         );
 
+        static PERROR runMatrix(
+            void   *context
+        );
+
+        static PERROR runDivider(
+            void   *context
+        );
+
         static PERROR clockPulse(
             void   *context
         );
@@ -132,6 +164,42 @@ class CStarWarsBaseGame : public CGame
             void   *context
         );
 
+        static PERROR captureVcd(
+            void   *context
+        );
+
+        static PERROR captureBinary(
+            void   *context
+        );
+
+        static PERROR sigNode(
+            void   *context
+        );
+
+        static PERROR signature(
+            void   *context
+        );
+
+        static PERROR capWalk(
+            void   *context
+        );
+
+        //
+        // The start functions of the capture & signature node windows.
+        //
+
+        static PERROR nodeStartMx17(
+            void   *context
+        );
+
+        static PERROR nodeStartMx18(
+            void   *context
+        );
+
+        static PERROR nodeStartDv21(
+            void   *context
+        );
+
     protected:
 
         CStarWarsBaseGame(
@@ -164,6 +232,17 @@ class CStarWarsBaseGame : public CGame
             UINT16 quotient
         );
 
+        static UINT16 dividerQuotient(
+            UINT16 dividend,
+            UINT16 divisor
+        );
+
+        PERROR sweepDivider(
+            UINT16  dividend,
+            UINT16  divisor,
+            UINT32 *lastDividend
+        );
+
         CCapture *m_capture;
 
         UINT32 m_clockPulseCount;
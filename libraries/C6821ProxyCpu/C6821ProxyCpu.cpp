@@ -229,3 +229,19 @@ C6821ProxyCpu::acknowledgeInterrupt(
 
     return error;
 }
+
+
+const BUS_STATS *
+C6821ProxyCpu::busStats(
+)
+{
+    return m_cpu->busStats();
+}
+
+
+void
+C6821ProxyCpu::clearBusStats(
+)
+{
+    m_cpu->clearBusStats();
+}
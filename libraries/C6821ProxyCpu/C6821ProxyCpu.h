@@ -96,6 +96,21 @@ class C6821ProxyCpu : public ICpu
             UINT16 *response
         );
 
+        //
+        // The proxy has no bus of its own, the stats are those of the CPU
+        // that performs the 6821 port accesses.
+        //
+
+        virtual
+        const BUS_STATS *
+        busStats(
+        );
+
+        virtual
+        void
+        clearBusStats(
+        );
+
     private:
 
         ICpu  *m_cpu;
@@ -228,6 +228,8 @@ C8080DedicatedCpu::outputAddressAndStatus(
     //
     if (io)
     {
+        BUS_STATS_INC(ioCycles);
+
         address = (address & ~0xFF00) | ((address & 0xFF) << 8);
     }
 
@@ -275,6 +277,8 @@ C8080DedicatedCpu::memoryRead(
 {
     PERROR error = errorSuccess;
 
+    BUS_STATS_INC(reads);
+
     outputAddressAndStatus(address, true);
 
     //
@@ -304,7 +308,8 @@ C8080DedicatedCpu::memoryRead(
     register UINT8 r1;
     register UINT8 r2;
 
-    // Critical timing section
+    // Critical timing section, the caller's interrupt state is restored after.
+    UINT8 sreg = SREG;
     noInterrupts();
 
     //
@@ -391,7 +396,7 @@ C8080DedicatedCpu::memoryRead(
 
 Exit:
 
-    interrupts();
+    SREG = sreg;
 
     return error;
 }
@@ -405,6 +410,8 @@ C8080DedicatedCpu::memoryWrite(
 {
     PERROR error = errorSuccess;
 
+    BUS_STATS_INC(writes);
+
     outputAddressAndStatus(address, false);
 
     //
@@ -433,7 +440,8 @@ C8080DedicatedCpu::memoryWrite(
     register UINT8 r1;
     register UINT8 r2;
 
-    // Critical timing section
+    // Critical timing section, the caller's interrupt state is restored after.
+    UINT8 sreg = SREG;
     noInterrupts();
 
     //
@@ -494,7 +502,7 @@ C8080DedicatedCpu::memoryWrite(
 
 Exit:
 
-    interrupts();
+    SREG = sreg;
 
     return error;
 }
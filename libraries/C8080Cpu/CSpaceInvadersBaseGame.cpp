@@ -25,6 +25,7 @@
 #include "CSpaceInvadersBaseGame.h"
 #include "C8080DedicatedCpu.h"
 #include "CRamCheck.h"
+#include "CScheduler.h"
 
 //
 // Probe Head GND:
@@ -49,6 +50,16 @@ static const UINT32 s_shifterCount  = 0x10002L;
 static const UINT32 s_shifterResult = 0x10003L;
 static const UINT32 s_shifterData   = 0x10004L;
 
+//
+// The shifter sweep data set. The walking 1's & 0's are followed by these
+// patterns and then by a stream of random bytes from a fixed seed.
+//
+static const UINT16 s_shifterPattern[] PROGMEM = {0x0000, 0xFFFF, 0x5555, 0xAAAA, 0x3333,
+                                                  0xCCCC, 0x0F0F, 0xF0F0, 0x00FF, 0xFF00};
+
+static const UINT16 s_shifterRandomWords = 1024;
+static const long   s_shifterRandomSeed  = 0x5349;
+
 //
 // RAM region is the same for all games on this board set.
 //
@@ -131,6 +142,7 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                            "0123456789"
                                                             {CSpaceInvadersBaseGame::testShifter,         "Test Shift"},
+                                                            {CSpaceInvadersBaseGame::sweepShifter,        "Sweep Shft"},
                                                             {NO_CUSTOM_FUNCTION}}; // end of list
 
 
@@ -224,10 +236,10 @@ CSpaceInvadersBaseGame::testShifter(
             {
                 error = errorCustom;
                 error->code = ERROR_FAILED;
-                error->description = "E:";
+                stringCopy(error->description, "E:");
                 STRING_UINT16_HEX(error->description, shiftData);
-                error->description += " ";
-                error->description += shiftCount;
+                stringAppend(error->description, " ");
+                stringAppendDec(error->description, shiftCount);
                 STRING_UINT8_HEX(error->description, shiftExpResult);
                 STRING_UINT8_HEX(error->description, shiftRecResult);
                 goto Exit;
@@ -240,3 +252,179 @@ CSpaceInvadersBaseGame::testShifter(
 Exit:
     return error;
 }
+
+
+//
+// Sweep all 8 shift counts over the whole shifter data set with the same
+// expected result as testShifter. Every vector is run, rather than stopping
+// on the first failure, so the failures can be summed per result bit and
+// split into bits that read 0 when 1 was expected and the other way around.
+//
+// The data register shifts a byte in on every write so only the last two
+// bytes written count. Where the low byte of a word is the high byte of the
+// one before it only the high byte is written, which makes the random part
+// of the sweep a single write per word.
+//
+// The per bit summary is sent to the serial port as "SHIFT,bit,1>0,0>1" lines
+// followed by "SHIFT,End,vectors,failures".
+//
+PERROR
+CSpaceInvadersBaseGame::sweepShifter(
+    void *context
+)
+{
+    CSpaceInvadersBaseGame *thisGame = (CSpaceInvadersBaseGame *) context;
+    C8080DedicatedCpu *cpu = thisGame->m_cpu;
+    PERROR error = errorSuccess;
+    UINT16 failOneToZero[8] = {0};
+    UINT16 failZeroToOne[8] = {0};
+    UINT8  maskOneToZero = 0;
+    UINT8  maskZeroToOne = 0;
+    UINT32 vectors = 0;
+    UINT32 failures = 0;
+    UINT16 shiftData = 0;
+    UINT16 words = (UINT16) (16 + 16 + ARRAYSIZE(s_shifterPattern) + s_shifterRandomWords);
+
+    randomSeed(s_shifterRandomSeed);
+
+    for (UINT16 index = 0 ; index < words ; index++)
+    {
+        UINT16 data = shifterSweepData(index, shiftData);
+
+        if ((index == 0) || ((data & 0xFF) != (shiftData >> 8)))
+        {
+            CHECK_CPU_WRITE_EXIT(error, cpu, s_shifterData, (data >> 0));
+        }
+        CHECK_CPU_WRITE_EXIT(error, cpu, s_shifterData, (data >> 8));
+
+        shiftData = data;
+
+        for (UINT8 shiftCount = 0 ; shiftCount < 8 ; shiftCount++)
+        {
+            UINT16 shiftRecResult;
+            UINT8  shiftExpResult = (UINT8) (shiftData >> (shiftCount + 1));
+            UINT8  difference;
+
+            CHECK_CPU_WRITE_EXIT(error, cpu, s_shifterCount, (~shiftCount & 0x7));
+            CHECK_CPU_READ_EXIT(error, cpu, s_shifterResult, &shiftRecResult);
+
+            vectors++;
+
+            difference = (UINT8) shiftRecResult ^ shiftExpResult;
+
+            if (difference == 0)
+            {
+                continue;
+            }
+
+            if (failures == 0)
+            {
+                errorDetail.address  = ((UINT32) shiftData << 8) | shiftCount;
+                errorDetail.expected = shiftExpResult;
+                errorDetail.received = (UINT8) shiftRecResult;
+            }
+
+            failures++;
+
+            maskOneToZero |= (difference &  shiftExpResult);
+            maskZeroToOne |= (difference & ~shiftExpResult);
+
+            for (UINT8 bit = 0 ; bit < 8 ; bit++)
+            {
+                if ((difference & (1 << bit)) == 0)
+                {
+                    continue;
+                }
+
+                if (shiftExpResult & (1 << bit))
+                {
+                    failOneToZero[bit]++;
+                }
+                else
+                {
+                    failZeroToOne[bit]++;
+                }
+            }
+        }
+
+        if ((index % 64) == 63)
+        {
+            YIELD_CHECK_ABORT_BREAK(error);
+        }
+    }
+
+    if (FAILED(error))
+    {
+        goto Exit;
+    }
+
+    for (UINT8 bit = 0 ; bit < 8 ; bit++)
+    {
+        Serial.print("SHIFT,");
+        Serial.print(bit);
+        Serial.print(",");
+        Serial.print(failOneToZero[bit]);
+        Serial.print(",");
+        Serial.println(failZeroToOne[bit]);
+    }
+
+    Serial.print("SHIFT,End,");
+    Serial.print(vectors);
+    Serial.print(",");
+    Serial.println(failures);
+
+    error = errorCustom;
+
+    if (failures == 0)
+    {
+        error->code = ERROR_SUCCESS;
+        stringCopy(error->description, "OK: Vec ");
+        stringAppendDec(error->description, vectors);
+    }
+    else
+    {
+        error->code = ERROR_FAILED;
+        stringCopy(error->description, "E:1>0 ");
+        stringAppendHex(error->description, maskOneToZero, 2);
+        stringAppend(error->description, " 0>1 ");
+        stringAppendHex(error->description, maskZeroToOne, 2);
+    }
+
+Exit:
+    return error;
+}
+
+
+//
+// The data word at 'index' of the sweep data set. The random words shift a
+// new random byte in above the high byte of the last word.
+//
+UINT16
+CSpaceInvadersBaseGame::shifterSweepData(
+    UINT16 index,
+    UINT16 lastData
+)
+{
+    if (index < 16)
+    {
+        return (UINT16) (1 << index);
+    }
+    index -= 16;
+
+    if (index < 16)
+    {
+        return (UINT16) ~(1 << index);
+    }
+    index -= 16;
+
+    if (index < ARRAYSIZE(s_shifterPattern))
+    {
+        UINT16 pattern;
+
+        memcpy_P(&pattern, &s_shifterPattern[index], sizeof(pattern));
+
+        return pattern;
+    }
+
+    return (lastData >> 8) | ((UINT16) random(0x100) << 8);
+}
@@ -46,6 +46,14 @@ class CSpaceInvadersBaseGame : public CGame
             void *context
         );
 
+        //
+        // Custom function to sweep the shifter over every shift count
+        // and a larger data set, with a per result bit failure summary.
+        //
+        static PERROR sweepShifter(
+            void *context
+        );
+
     protected:
 
         CSpaceInvadersBaseGame(
@@ -55,6 +63,13 @@ class CSpaceInvadersBaseGame : public CGame
         ~CSpaceInvadersBaseGame(
         );
 
+    private:
+
+        static UINT16 shifterSweepData(
+            UINT16 index,
+            UINT16 lastData
+        );
+
 };
 
 #endif
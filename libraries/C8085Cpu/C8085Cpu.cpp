@@ -269,6 +269,7 @@ C8085Cpu::memoryReadWrite(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
 
     bool io        = (address & 0x010000) ? true : false;
     bool readySync = (address & 0x100000) ? true : false;
@@ -276,6 +277,8 @@ C8085Cpu::memoryReadWrite(
     // Assert the bus state
     if (io)
     {
+        BUS_STATS_INC(ioCycles);
+
         m_pinIO_M.digitalWriteHIGH();
     }
 
@@ -318,9 +321,12 @@ C8085Cpu::memoryReadWrite(
     if (readySync)
     {
         int value;
+        int i;
+        UINT16 polls = 0;
+        UINT8 startTicks = BUS_STATS_TICKS();
 
         // Wait for active
-        for (int i = 0 ; i < 8192 ; i++)
+        for (i = 0 ; i < 8192 ; i++)
         {
             value = m_pinREADY.digitalRead();
 
@@ -329,10 +335,12 @@ C8085Cpu::memoryReadWrite(
                 break;
             }
         }
+        polls += i;
+        BUS_STATS_INC_IF(value != LOW, timeouts);
         CHECK_LITERAL_VALUE_EXIT(error, s_READY_i, value, LOW);
 
         // Wait for inactive
-        for (int i = 0 ; i < 8192 ; i++)
+        for (i = 0 ; i < 8192 ; i++)
         {
             value = m_pinREADY.digitalRead();
 
@@ -341,7 +349,11 @@ C8085Cpu::memoryReadWrite(
                 break;
             }
         }
+        polls += i;
+        BUS_STATS_INC_IF(value != HIGH, timeouts);
         CHECK_LITERAL_VALUE_EXIT(error, s_READY_i, value, HIGH);
+
+        BUS_STATS_CYCLE(polls, (UINT8) (BUS_STATS_TICKS() - startTicks));
     }
 
     // Perform the data access
@@ -369,9 +381,10 @@ C8085Cpu::memoryReadWrite(
 
 Exit:
 
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
 
     return error;
@@ -384,6 +397,8 @@ C8085Cpu::memoryRead(
     UINT16 *data
 )
 {
+    BUS_STATS_INC(reads);
+
     return memoryReadWrite(address, data, true);
 }
 
@@ -394,6 +409,8 @@ C8085Cpu::memoryWrite(
     UINT16 data
 )
 {
+    BUS_STATS_INC(writes);
+
     return memoryReadWrite(address, &data, false);
 }
 
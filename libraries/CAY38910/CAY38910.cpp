@@ -23,6 +23,7 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //
 #include "CAY38910.h"
+#include "CAuxSignal.h"
 
 
 static const UINT8 AY_R00_CHA_FINE_TONE     = 0x0;
@@ -42,6 +43,24 @@ static const UINT8 AY_R15_COARSE_ENV_SHAPE  = 0xD;
 static const UINT8 AY_R16_PORT_A_DATA       = 0xE;
 static const UINT8 AY_R17_PORT_B_DATA       = 0xF;
 
+//
+// The implemented bits of R0 to R15 (octal). The IO direction bits of the
+// enable register are masked off to keep the ports as inputs.
+//
+static const UINT8 s_registerMask[] = {0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0x1F, 0x3F,
+                                       0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0x0F};
+
+//
+// The tone periods measured by the tone check, ~250Hz & ~500Hz at the
+// common 1.79MHz clock. Both are slow enough for the ADC sample rate.
+//
+static const UINT16 s_tonePeriod[] = {0x1C0, 0x0E0};
+
+//
+// A measured frequency within this many percent of the expected passes.
+//
+static const UINT32 s_toneTolerancePercent = 3;
+
 
 CAY38910::CAY38910(
     ICpu   *cpu,
@@ -224,6 +243,239 @@ CAY38910::noise(
 }
 
 
+//
+// The walking bits are written & read back one register at a time so that
+// a failure is reported against the register and bit at fault. The second
+// pass gives each register a different value and only reads them back once
+// they've all been written, so a write landing in the wrong register shows.
+//
+PERROR
+CAY38910::registers(
+)
+{
+    PERROR error = errorSuccess;
+
+    for (UINT8 reg = 0 ; reg < ARRAYSIZE(s_registerMask) ; reg++)
+    {
+        UINT8 mask = s_registerMask[reg];
+
+        for (UINT8 bit = 0 ; bit < 8 ; bit++)
+        {
+            UINT8 walk[2] = {(UINT8) ((1 << bit) & mask), (UINT8) (~(1 << bit) & mask)};
+
+            if (((1 << bit) & mask) == 0)
+            {
+                continue;
+            }
+
+            for (UINT8 pass = 0 ; pass < 2 ; pass++)
+            {
+                UINT8 rec = 0;
+
+                error = write(reg, walk[pass]);
+                if (SUCCESS(error))
+                {
+                    error = read(reg, &rec);
+                }
+                if (FAILED(error))
+                {
+                    break;
+                }
+
+                CHECK_VALUE_UINT8_BREAK(error, "AY3", reg, walk[pass], (rec & mask));
+            }
+
+            if (FAILED(error))
+            {
+                break;
+            }
+        }
+
+        if (FAILED(error))
+        {
+            break;
+        }
+    }
+
+    for (UINT8 reg = 0 ; SUCCESS(error) && (reg < ARRAYSIZE(s_registerMask)) ; reg++)
+    {
+        error = write(reg, (UINT8) ((reg + 1) * 0x11) & s_registerMask[reg]);
+    }
+
+    for (UINT8 reg = 0 ; SUCCESS(error) && (reg < ARRAYSIZE(s_registerMask)) ; reg++)
+    {
+        UINT8 exp = (UINT8) ((reg + 1) * 0x11) & s_registerMask[reg];
+        UINT8 rec = 0;
+
+        error = read(reg, &rec);
+        if (FAILED(error))
+        {
+            break;
+        }
+
+        CHECK_VALUE_UINT8_BREAK(error, "AY3", reg, exp, (rec & s_registerMask[reg]));
+    }
+
+    if (SUCCESS(error))
+    {
+        error = idle();
+    }
+
+    return error;
+}
+
+
+PERROR
+CAY38910::portLoopback(
+    Port output,
+    Port input
+)
+{
+    PERROR error = errorSuccess;
+    UINT8 outputReg = (output == IOA) ? AY_R16_PORT_A_DATA : AY_R17_PORT_B_DATA;
+    UINT8 inputReg  = (input  == IOA) ? AY_R16_PORT_A_DATA : AY_R17_PORT_B_DATA;
+
+    // Channels off, with only the output port set as an output (IOA is bit 6, IOB bit 7).
+    error = write(AY_R07_ENABLE, 0x3F | ((output == IOA) ? 0x40 : 0x80));
+
+    for (UINT8 bit = 0 ; SUCCESS(error) && (bit < 8) ; bit++)
+    {
+        UINT8 walk[2] = {(UINT8) (1 << bit), (UINT8) ~(1 << bit)};
+
+        for (UINT8 pass = 0 ; pass < 2 ; pass++)
+        {
+            UINT8 rec = 0;
+
+            error = write(outputReg, walk[pass]);
+            if (SUCCESS(error))
+            {
+                error = read(inputReg, &rec);
+            }
+            if (FAILED(error))
+            {
+                break;
+            }
+
+            CHECK_VALUE_UINT8_BREAK(error, "AYP", inputReg, walk[pass], rec);
+        }
+    }
+
+    // Put both ports back to inputs whatever happened.
+    {
+        PERROR idleError = idle();
+
+        if (SUCCESS(error))
+        {
+            error = idleError;
+        }
+    }
+
+    return error;
+}
+
+
+PERROR
+CAY38910::tones(
+    UINT32 clockInHz,
+    UINT8  auxPinChA
+)
+{
+    PERROR error = errorSuccess;
+    UINT8 failChannel = 0;
+    UINT32 failExpected = 0;
+    UINT32 failReceived = 0;
+
+    for (UINT8 channel = CHA ; SUCCESS(error) && (channel <= CHC) ; channel++)
+    {
+        UINT8 fineReg   = AY_R00_CHA_FINE_TONE + (channel * 2);
+        UINT8 coarseReg = AY_R01_CHA_COARSE_TONE + (channel * 2);
+
+        // Only this channel's tone enabled (active low), noise off, ports as inputs.
+        error = write(AY_R07_ENABLE, 0x3F & ~(1 << channel));
+        if (SUCCESS(error))
+        {
+            error = write(AY_R10_CHA_AMPLITUDE + channel, 0x0F);
+        }
+
+        for (UINT8 index = 0 ; SUCCESS(error) && (index < ARRAYSIZE(s_tonePeriod)) ; index++)
+        {
+            UINT16 period = s_tonePeriod[index];
+            UINT32 expected = (clockInHz + (8 * period)) / (16 * (UINT32) period);
+            UINT32 received = 0;
+            UINT32 tolerance = (expected * s_toneTolerancePercent) / 100;
+            bool pass;
+
+            error = write(fineReg, (UINT8) (period & 0xFF));
+            if (SUCCESS(error))
+            {
+                error = write(coarseReg, (UINT8) (period >> 8));
+            }
+            if (SUCCESS(error))
+            {
+                CAuxSignal::frequency(auxPinChA + channel, &received);
+            }
+            if (FAILED(error))
+            {
+                break;
+            }
+
+            pass = (received + tolerance >= expected) && (received <= expected + tolerance);
+
+            Serial.print("TONE,");
+            Serial.print((char) ('A' + channel));
+            Serial.print(",");
+            Serial.print(period);
+            Serial.print(",");
+            Serial.print(expected);
+            Serial.print(",");
+            Serial.print(received);
+            Serial.println(pass ? ",PASS" : ",FAIL");
+
+            if (!pass && (failExpected == 0))
+            {
+                failChannel  = channel;
+                failExpected = expected;
+                failReceived = received;
+            }
+        }
+
+        if (SUCCESS(error))
+        {
+            error = write(AY_R10_CHA_AMPLITUDE + channel, 0x00);
+        }
+    }
+
+    if (SUCCESS(error))
+    {
+        error = idle();
+    }
+
+    if (SUCCESS(error))
+    {
+        error = errorCustom;
+
+        if (failExpected == 0)
+        {
+            error->code = ERROR_SUCCESS;
+            stringCopy(error->description, "OK: Tone ABC");
+        }
+        else
+        {
+            error->code = ERROR_FAILED;
+            stringCopy(error->description, "E:");
+            stringAppendHex(error->description, 0xA + failChannel, 1);
+            stringAppend(error->description, " ");
+            stringAppendDec(error->description, failExpected);
+            stringAppend(error->description, "/");
+            stringAppendDec(error->description, failReceived);
+            stringAppend(error->description, "Hz");
+        }
+    }
+
+    return error;
+}
+
+
 PERROR
 CAY38910::read(
     UINT8 reg,
@@ -34,7 +34,7 @@
 // IO locations, one to set the register address to access and the other
 // to read or write data to it.
 //
-class CAY38910
+class CAY38910 : public CArenaObject
 {
     public:
 
@@ -81,6 +81,42 @@ class CAY38910
             Channel channel
         );
 
+        //
+        // Walking 1 & 0 read back of every bit of registers R0 to R15 (the
+        // datasheet's octal numbering, 0x0 to 0xD) followed by a check that
+        // each register holds its own value to catch register select faults.
+        // The port data registers are left out as their contents depend on
+        // the port wiring, and the IO direction bits of the enable register
+        // are held as inputs so nothing on the ports is driven.
+        //
+        PERROR registers(
+        );
+
+        //
+        // Walk a bit through the output port and read it back on the input
+        // port. This is only of use where the two ports are wired together,
+        // e.g. by a test jig, as otherwise the output would drive into the
+        // board's own port circuitry.
+        //
+        PERROR portLoopback(
+            Port output,
+            Port input
+        );
+
+        //
+        // Program each channel in turn to a set of tone periods and measure
+        // the frequency of its analog output on the J14 AUX pin given for
+        // the channel (channel A on the first). The expected frequency is
+        // the clock / (16 x period).
+        //
+        // Each measurement is sent to the serial port as a line of
+        // "TONE,channel,period,expected Hz,received Hz,PASS|FAIL".
+        //
+        PERROR tones(
+            UINT32 clockInHz,
+            UINT8  auxPinChA
+        );
+
     private:
 
         PERROR read(
@@ -23,7 +23,7 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //
 #include "CCapture.h"
-#include "C6809EClockMasterCpu.h"
+#include "IClockMasterCpu.h"
 
 #include "PinMap.h"
 
@@ -32,10 +32,35 @@
 //
 static const CONNECTION s_AUX1_i = {1, "AUX1"};
 
+//
+// The deep capture reads all of J14 in one go as it's wired to port K.
+// AUX pin 8 (PK7) is the master clock output so it always reads low.
+//
+#define CAPTURE_PORT_READ() (PINK)
+
+static const UINT8 c_auxPins = 8;
+
+//
+// The HP signature character set, it avoids the letters that are easily
+// confused on a 7-segment display.
+//
+static const char s_signatureChars[] PROGMEM = "0123456789ACFHPU";
+
 
 CCapture::CCapture(
-    ICpu *cpu
-) : m_cpu(cpu)
+    ICpu                 *cpu,
+    const CAPTURE_NODE   *captureNode,
+    UINT16                captureNodes,
+    const SIGNATURE_NODE *signatureNode,
+    UINT16                signatureNodes
+) : m_cpu(cpu),
+    m_captureNode(captureNode),
+    m_captureNodes(captureNodes),
+    m_captureNodeIndex(c_noNode),
+    m_signatureNode(signatureNode),
+    m_signatureNodes(signatureNodes),
+    m_signatureNodeIndex(c_noNode),
+    m_walkFailures(0)
 {
 }
 
@@ -56,7 +81,7 @@ PERROR
 CCapture::capture32(
 )
 {
-    C6809EClockMasterCpu *cpu = (C6809EClockMasterCpu *) m_cpu;
+    IClockMasterCpu *cpu = (IClockMasterCpu *) m_cpu;
     PERROR error = errorCustom;
     UINT8 capture[4] = {0,0,0,0};
 
@@ -79,7 +104,7 @@ CCapture::capture32(
     }
 
     error->code = ERROR_SUCCESS;
-    error->description = "OK: ";
+    stringCopy(error->description, "OK: ");
 
     for (int byte = 0 ; byte < 4 ; byte++)
     {
@@ -89,3 +114,566 @@ CCapture::capture32(
     return error;
 }
 
+
+//
+// Deep Signal Capture
+// -------------------
+// The sampling loop is kept to a clock, a port read and a compare so that
+// the interval between samples stays even. Interrupts are off throughout,
+// so for the default 8192 clocks the keypad & serial are held off for a
+// few milliseconds.
+//
+PERROR
+CCapture::captureDeep(
+    Format format,
+    UINT32 preDelay,
+    UINT16 clocks
+)
+{
+    IClockMasterCpu *cpu = (IClockMasterCpu *) m_cpu;
+    PERROR error = errorCustom;
+    UINT8 *buffer = (UINT8 *) malloc(c_bufferSize);
+    UINT8 *run = buffer;
+    UINT16 runs = 0;
+    UINT16 clock = 0;
+
+    if (buffer == NULL)
+    {
+        error->code = ERROR_FAILED;
+        stringCopy(error->description, "E: No memory");
+        return error;
+    }
+
+    // Leave the clock output (pin 8) alone.
+    for (UINT8 pin = 1 ; pin < c_auxPins ; pin++)
+    {
+        ::pinMode(g_pinMap8Aux[pin], INPUT);
+    }
+
+    noInterrupts();
+
+    cpu->clockPulses(preDelay);
+
+    for (clock = 0 ; clock < clocks ; clock++)
+    {
+        cpu->clockPulse();
+
+        UINT8 value = CAPTURE_PORT_READ();
+
+        if ((runs != 0) && (run[0] == value) && (run[1] != 0xFF))
+        {
+            run[1]++;
+        }
+        else if (runs < (c_bufferSize / 2))
+        {
+            run = &buffer[runs * 2];
+            run[0] = value;
+            run[1] = 0;
+            runs++;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    interrupts();
+
+    if (format == VCD)
+    {
+        printVcd(buffer, runs);
+    }
+    else
+    {
+        printBinary(buffer, runs, clock);
+    }
+
+    free(buffer);
+
+    error->code = ERROR_SUCCESS;
+    stringCopy(error->description, "OK: ");
+    stringAppendDec(error->description, clock);
+    stringAppend(error->description, " clocks");
+
+    return error;
+}
+
+
+//
+// The 8 pins are 1-bit wires with the single character identifiers '1' to '8'
+// so the dump reads naturally. Only the pins that changed are dumped at each
+// time step.
+//
+void
+CCapture::printVcd(
+    const UINT8 *buffer,
+    UINT16       runs
+)
+{
+    UINT32 time = 0;
+
+    Serial.println("$version arduino-mega-ict CCapture $end");
+    Serial.println("$comment One time unit is one clock pulse $end");
+    Serial.println("$timescale 1 ns $end");
+    Serial.println("$scope module aux $end");
+
+    for (UINT8 pin = 0 ; pin < c_auxPins ; pin++)
+    {
+        Serial.print("$var wire 1 ");
+        Serial.print((char) ('1' + pin));
+        Serial.print(" AUX");
+        Serial.print((char) ('1' + pin));
+        Serial.println(" $end");
+    }
+
+    Serial.println("$upscope $end");
+    Serial.println("$enddefinitions $end");
+
+    for (UINT16 run = 0 ; run < runs ; run++)
+    {
+        UINT8 value   = buffer[run * 2];
+        UINT8 changed = (run == 0) ? 0xFF : (value ^ buffer[(run - 1) * 2]);
+
+        Serial.print('#');
+        Serial.println(time, DEC);
+
+        for (UINT8 pin = 0 ; pin < c_auxPins ; pin++)
+        {
+            if (changed & (1 << pin))
+            {
+                Serial.print((value & (1 << pin)) ? '1' : '0');
+                Serial.println((char) ('1' + pin));
+            }
+        }
+
+        time += (UINT32) buffer[(run * 2) + 1] + 1;
+    }
+
+    // Mark the end of the capture so the last run has a length.
+    Serial.print('#');
+    Serial.println(time, DEC);
+}
+
+
+void
+CCapture::printBinary(
+    const UINT8 *buffer,
+    UINT16       runs,
+    UINT16       clocks
+)
+{
+    Serial.print("CAPTURE,Bin,");
+    Serial.print(runs, DEC);
+    Serial.print(',');
+    Serial.println(clocks, DEC);
+
+    Serial.write(buffer, runs * 2);
+    Serial.println();
+}
+
+
+PERROR
+CCapture::signature(
+    UINT8   dataPin,
+    UINT32  clocks,
+    UINT16 *signature,
+    UINT32 *clocksRun,
+    UINT8   stopPin,
+    UINT8   stopLevel
+)
+{
+    IClockMasterCpu *cpu = (IClockMasterCpu *) m_cpu;
+    UINT8  dataMask = (UINT8) (1 << (dataPin - 1));
+    UINT8  stopMask = (stopPin == 0) ? 0 : (UINT8) (1 << (stopPin - 1));
+    UINT8  stopValue = (stopLevel == HIGH) ? stopMask : 0;
+    UINT16 lfsr = 0;
+    UINT32 clock;
+
+    ::pinMode(g_pinMap8Aux[dataPin], INPUT);
+
+    if (stopPin != 0)
+    {
+        ::pinMode(g_pinMap8Aux[stopPin], INPUT);
+    }
+
+    noInterrupts();
+
+    for (clock = 0 ; clock < clocks ; clock++)
+    {
+        cpu->clockPulse();
+
+        UINT8 value = CAPTURE_PORT_READ();
+
+        lfsr = signatureShift(lfsr, (value & dataMask) != 0);
+
+        if ((stopMask != 0) && ((value & stopMask) == stopValue))
+        {
+            clock++;
+            break;
+        }
+    }
+
+    interrupts();
+
+    *signature = lfsr;
+    *clocksRun = clock;
+
+    return errorSuccess;
+}
+
+
+PERROR
+CCapture::signatureNodeNext(
+)
+{
+    PERROR error = errorCustom;
+    SIGNATURE_NODE node;
+
+    if (m_signatureNodes == 0)
+    {
+        return errorNotImplemented;
+    }
+
+    if ((m_signatureNodeIndex + 1) < m_signatureNodes)
+    {
+        m_signatureNodeIndex++;
+    }
+    else
+    {
+        m_signatureNodeIndex = 0;
+    }
+
+    memcpy_P(&node, &m_signatureNode[m_signatureNodeIndex], sizeof(node));
+
+    error->code = ERROR_SUCCESS;
+    stringCopy(error->description, "OK: Probe ");
+    stringAppendNode(error->description, node.location, node.pin);
+
+    return error;
+}
+
+
+PERROR
+CCapture::signatureNodeCheck(
+    void *context
+)
+{
+    PERROR error = errorSuccess;
+    SIGNATURE_NODE node;
+    UINT16 recSignature = 0;
+    UINT32 clocksRun = 0;
+
+    if (m_signatureNodes == 0)
+    {
+        return errorNotImplemented;
+    }
+
+    // Start at the first node if none has been stepped to yet.
+    if (m_signatureNodeIndex == c_noNode)
+    {
+        m_signatureNodeIndex = 0;
+    }
+
+    memcpy_P(&node, &m_signatureNode[m_signatureNodeIndex], sizeof(node));
+
+    if (node.start != NO_CUSTOM_FUNCTION)
+    {
+        error = node.start(context);
+    }
+
+    if (SUCCESS(error))
+    {
+        error = signature(s_AUX1_i.pin, node.clocks, &recSignature, &clocksRun);
+    }
+
+    if (SUCCESS(error))
+    {
+        error = errorCustom;
+
+        if (recSignature == node.signature)
+        {
+            error->code = ERROR_SUCCESS;
+            stringCopy(error->description, "OK: ");
+        }
+        else
+        {
+            errorDetail.address  = node.pin;
+            errorDetail.expected = node.signature;
+            errorDetail.received = recSignature;
+
+            error->code = ERROR_FAILED;
+            stringCopy(error->description, "E: ");
+        }
+
+        stringAppendNode(error->description, node.location, node.pin);
+        stringAppend(error->description, " ");
+        stringAppendSignature(error->description, recSignature);
+    }
+
+    return error;
+}
+
+
+PERROR
+CCapture::nodeNext(
+)
+{
+    PERROR error = errorCustom;
+    CAPTURE_NODE node;
+
+    if (m_captureNodes == 0)
+    {
+        return errorNotImplemented;
+    }
+
+    if ((m_captureNodeIndex + 1) < m_captureNodes)
+    {
+        m_captureNodeIndex++;
+    }
+    else
+    {
+        m_captureNodeIndex = 0;
+    }
+
+    memcpy_P(&node, &m_captureNode[m_captureNodeIndex], sizeof(node));
+
+    error->code = ERROR_SUCCESS;
+    stringCopy(error->description, "OK: Probe ");
+    stringAppendNode(error->description, node.location, node.pin);
+
+    return error;
+}
+
+
+PERROR
+CCapture::nodeWalk(
+    void *context
+)
+{
+    PERROR error = errorSuccess;
+    CAPTURE_NODE node;
+    UINT8 bits[CAPTURE_NODE_BYTES];
+    UINT8 failClock = 0;
+
+    //
+    // The first call of a walk only asks for the probe to be put on the
+    // first node.
+    //
+    if (m_captureNodeIndex == c_noNode)
+    {
+        m_walkFailures = 0;
+        return nodeNext();
+    }
+
+    error = nodeStart(&node, context);
+
+    if (FAILED(error))
+    {
+        return error;
+    }
+
+    captureBits(s_AUX1_i.pin, node.clocks, bits);
+
+    for (UINT8 clock = 0 ; clock < node.clocks ; clock++)
+    {
+        UINT8 mask = 0x80 >> (clock % 8);
+
+        if ((bits[clock / 8] ^ node.pattern[clock / 8]) & mask)
+        {
+            errorDetail.address  = clock + 1;
+            errorDetail.expected = (node.pattern[clock / 8] & mask) ? 1 : 0;
+            errorDetail.received = (bits[clock / 8] & mask) ? 1 : 0;
+
+            failClock = clock + 1;
+            break;
+        }
+    }
+
+    Serial.print("WALK,");
+    Serial.print(node.location);
+    Serial.print('-');
+    Serial.print(node.pin, DEC);
+
+    if (failClock == 0)
+    {
+        Serial.println(",PASS");
+    }
+    else
+    {
+        Serial.print(",FAIL,");
+        Serial.print(failClock, DEC);
+        Serial.print(',');
+
+        for (UINT8 byte = 0 ; byte < ((node.clocks + 7) / 8) ; byte++)
+        {
+            if (bits[byte] < 0x10)
+            {
+                Serial.print('0');
+            }
+            Serial.print(bits[byte], HEX);
+        }
+
+        Serial.println();
+
+        m_walkFailures++;
+    }
+
+    error = errorCustom;
+    error->code = (failClock == 0) ? ERROR_SUCCESS : ERROR_FAILED;
+    stringCopy(error->description, (failClock == 0) ? "OK " : "E ");
+    stringAppendNode(error->description, node.location, node.pin);
+
+    if (failClock != 0)
+    {
+        stringAppend(error->description, "@");
+        stringAppendDec(error->description, failClock);
+    }
+
+    //
+    // Move on and show the next node to probe. The end of a pass is logged
+    // with the number of nodes that failed.
+    //
+    if ((m_captureNodeIndex + 1) < m_captureNodes)
+    {
+        m_captureNodeIndex++;
+    }
+    else
+    {
+        Serial.print("WALK,End,");
+        Serial.println(m_walkFailures, DEC);
+
+        m_captureNodeIndex = 0;
+        m_walkFailures = 0;
+    }
+
+    memcpy_P(&node, &m_captureNode[m_captureNodeIndex], sizeof(node));
+
+    stringAppend(error->description, ">");
+    stringAppendNode(error->description, node.location, node.pin);
+
+    return error;
+}
+
+
+//
+// Copy the current node (the first if none has been stepped to yet) and run
+// its start function.
+//
+PERROR
+CCapture::nodeStart(
+    CAPTURE_NODE *node,
+    void         *context
+)
+{
+    PERROR error = errorSuccess;
+
+    if (m_captureNodes == 0)
+    {
+        return errorNotImplemented;
+    }
+
+    if (m_captureNodeIndex == c_noNode)
+    {
+        m_captureNodeIndex = 0;
+    }
+
+    memcpy_P(node, &m_captureNode[m_captureNodeIndex], sizeof(*node));
+
+    if (node->start != NO_CUSTOM_FUNCTION)
+    {
+        error = node->start(context);
+    }
+
+    return error;
+}
+
+
+//
+// The same sampling as capture32 but from the port and with the bits packed
+// the same way as the node patterns.
+//
+void
+CCapture::captureBits(
+    UINT8  dataPin,
+    UINT8  clocks,
+    UINT8 *bits
+)
+{
+    IClockMasterCpu *cpu = (IClockMasterCpu *) m_cpu;
+    UINT8 dataMask = (UINT8) (1 << (dataPin - 1));
+
+    memset(bits, 0, CAPTURE_NODE_BYTES);
+
+    if (clocks > (CAPTURE_NODE_BYTES * 8))
+    {
+        clocks = CAPTURE_NODE_BYTES * 8;
+    }
+
+    ::pinMode(g_pinMap8Aux[dataPin], INPUT);
+
+    noInterrupts();
+
+    for (UINT8 clock = 0 ; clock < clocks ; clock++)
+    {
+        cpu->clockPulse();
+
+        if (CAPTURE_PORT_READ() & dataMask)
+        {
+            bits[clock / 8] |= (0x80 >> (clock % 8));
+        }
+    }
+
+    interrupts();
+}
+
+
+//
+// One clock of the LFSR, the feedback taps are at 7, 9, 12 & 16.
+//
+UINT16
+CCapture::signatureShift(
+    UINT16 lfsr,
+    bool   bit
+)
+{
+    UINT16 feedback = (lfsr >> 6) ^ (lfsr >> 8) ^ (lfsr >> 11) ^ (lfsr >> 15);
+
+    if (bit)
+    {
+        feedback ^= 1;
+    }
+
+    return (lfsr << 1) | (feedback & 1);
+}
+
+
+void
+CCapture::stringAppendNode(
+    CHAR       *string,
+    const CHAR *location,
+    UINT8       pin
+)
+{
+    stringAppend(string, location);
+    stringAppend(string, "-");
+    stringAppendDec(string, pin);
+}
+
+
+void
+CCapture::stringAppendSignature(
+    CHAR   *string,
+    UINT16  signature
+)
+{
+    CHAR text[5];
+
+    for (int digit = 0 ; digit < 4 ; digit++)
+    {
+        text[digit] = pgm_read_byte(&s_signatureChars[(signature >> (12 - (digit * 4))) & 0xF]);
+    }
+
+    text[4] = '\0';
+
+    stringAppend(string, text);
+}
@@ -29,14 +29,85 @@
 
 
 //
-// Implementation for signal capture extensions
+// A known good signature of a node (IC pin) on the board. The start function
+// (e.g. a game custom test) sets up the board, then the signature of AUX pin 1
+// is taken over the following clocks. Tables of these are kept in PROGMEM.
 //
-class CCapture
+typedef struct _SIGNATURE_NODE {
+
+    CustomFunctionCallback start;
+    UINT16                 clocks;
+    UINT16                 signature;
+    CHAR                   location[4]; // 3 characters
+    UINT8                  pin;
+
+} SIGNATURE_NODE, *PSIGNATURE_NODE;
+
+
+//
+// The longest known good pattern of a capture node in bytes (96 clocks).
+//
+#define CAPTURE_NODE_BYTES 12
+
+//
+// The known good pattern of a node (IC pin) on the board, as documented in
+// a captures file. The start function sets up the board the same way as for
+// a signature node, then AUX pin 1 is sampled on each of the following clocks.
+// The pattern has clock 1 in bit 7 of the first byte. The patterns are only
+// used for the guided walk, the signatures are kept separately as they can
+// cover longer windows and be measured on a known good board. Tables of these
+// are kept in PROGMEM.
+//
+typedef struct _CAPTURE_NODE {
+
+    CustomFunctionCallback start;
+    UINT8                  clocks;
+    UINT8                  pattern[CAPTURE_NODE_BYTES];
+    CHAR                   location[4]; // 3 characters
+    UINT8                  pin;
+
+} CAPTURE_NODE, *PCAPTURE_NODE;
+
+
+//
+// Implementation for signal capture extensions.
+// The CPU must be a clock master (see IClockMasterCpu).
+//
+class CCapture : public CArenaObject
 {
     public:
 
+        //
+        // How a deep capture is streamed to the serial port.
+        //
+        //  VCD    - A Value Change Dump text file of the 8 AUX pins with one
+        //           time unit per clock, loadable by any waveform viewer.
+        //  BINARY - A "CAPTURE,Bin,<runs>,<clocks>" line followed by the raw
+        //           runs (see below). Around 10x less to send than the VCD,
+        //           utilities/CaptureToVcd converts a saved log to VCD.
+        //
+        typedef enum {
+            VCD,
+            BINARY
+        } Format;
+
+        //
+        // The capture buffer holds runs of two bytes, the sampled AUX port
+        // value and the number of further clocks it was held for (0-255).
+        //
+        static const UINT16 c_bufferSize = 1024;
+
+        static const UINT16 c_defaultClocks = 8192;
+
+        //
+        // The capture & signature node tables are in PROGMEM and are optional.
+        //
         CCapture(
-            ICpu *cpu
+            ICpu                 *cpu,
+            const CAPTURE_NODE   *captureNode    = (CAPTURE_NODE *) NULL,
+            UINT16                captureNodes   = 0,
+            const SIGNATURE_NODE *signatureNode  = (SIGNATURE_NODE *) NULL,
+            UINT16                signatureNodes = 0
         );
 
         ~CCapture(
@@ -45,9 +116,126 @@ class CCapture
         PERROR capture32(
         );
 
+        //
+        // Sample all 8 J14 AUX pins on each of the clocks after running
+        // the pre-delay clocks, then stream the capture out of the serial port.
+        // The capture stops early if the buffer fills up with runs.
+        //
+        PERROR captureDeep(
+            Format format,
+            UINT32 preDelay = 0,
+            UINT16 clocks   = c_defaultClocks
+        );
+
+        //
+        // Signature analysis in the style of the HP 5004A. The data pin is
+        // sampled after each clock and shifted into a 16-bit LFSR with the
+        // feedback taps at 7, 9, 12 & 16. The window ends after the clocks
+        // or, if a stop pin is given, as soon as it reads the stop level.
+        // The clocks actually run are returned in clocksRun.
+        //
+        PERROR signature(
+            UINT8   dataPin,
+            UINT32  clocks,
+            UINT16 *signature,
+            UINT32 *clocksRun,
+            UINT8   stopPin   = 0,
+            UINT8   stopLevel = LOW
+        );
+
+        //
+        // Step on to the next node in the signature node table (wrapping
+        // around at the end) and show where the probe needs to go.
+        //
+        PERROR signatureNodeNext(
+        );
+
+        //
+        // Take the signature of the current node after running its start
+        // function with the context and compare it with the known good one.
+        //
+        PERROR signatureNodeCheck(
+            void *context
+        );
+
+        //
+        // Step on to the next node in the capture node table (wrapping
+        // around at the end) and show where the probe needs to go.
+        //
+        PERROR nodeNext(
+        );
+
+        //
+        // Guided walk of the capture nodes. Each call captures the current
+        // node and compares it bit by bit with the known good pattern, the
+        // result (with the first clock that differs) is shown along with
+        // the next node to probe. A "WALK" line is logged to the serial port
+        // per node so a whole board walk can be kept.
+        //
+        PERROR nodeWalk(
+            void *context
+        );
+
+        //
+        // Append the 4 character signature in the HP character set
+        // (0-9, A, C, F, H, P, U) that's used in service manuals.
+        //
+        static void stringAppendSignature(
+            CHAR   *string,
+            UINT16  signature
+        );
+
     private:
 
-        ICpu *m_cpu;
+        void printVcd(
+            const UINT8 *buffer,
+            UINT16       runs
+        );
+
+        void printBinary(
+            const UINT8 *buffer,
+            UINT16       runs,
+            UINT16       clocks
+        );
+
+        PERROR nodeStart(
+            CAPTURE_NODE *node,
+            void         *context
+        );
+
+        void captureBits(
+            UINT8  dataPin,
+            UINT8  clocks,
+            UINT8 *bits
+        );
+
+        static UINT16 signatureShift(
+            UINT16 lfsr,
+            bool   bit
+        );
+
+        static void stringAppendNode(
+            CHAR       *string,
+            const CHAR *location,
+            UINT8       pin
+        );
+
+        static const UINT16 c_noNode = 0xFFFF;
+
+        ICpu                 *m_cpu;
+
+        const CAPTURE_NODE   *m_captureNode;
+        UINT16                m_captureNodes;
+        UINT16                m_captureNodeIndex;
+
+        const SIGNATURE_NODE *m_signatureNode;
+        UINT16                m_signatureNodes;
+        UINT16                m_signatureNodeIndex;
+
+        //
+        // The number of nodes that failed in this pass of the walk.
+        //
+        UINT16                m_walkFailures;
 };
 
 #endif
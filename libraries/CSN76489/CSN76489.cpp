@@ -0,0 +1,464 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CSN76489.h"
+#include "CAuxSignal.h"
+
+//
+// A latch byte has the top bit set, then the channel (2 bits) and the
+// register type (tone/noise or attenuation) followed by 4 bits of data.
+// A following data byte (top bit clear) carries the upper 6 bits of a tone
+// period.
+//
+static const UINT8 SN_LATCH            = 0x80;
+static const UINT8 SN_ATTENUATION      = 0x10;
+static const UINT8 SN_CHANNEL_SHIFT    = 5;
+static const UINT8 SN_NOISE_WHITE      = 0x04;
+
+static const UINT8 SN_ATTENUATION_OFF  = 0x0F;
+
+//
+// The tone periods swept by the tone check. At the common 1.79MHz clock
+// these are ~125Hz, ~250Hz & ~500Hz.
+//
+static const UINT16 s_tonePeriod[] = {0x1C0, 0x0E0, 0x070};
+
+//
+// The period used for the attenuation check, one in the middle of the
+// sweep that gives several cycles within the level sampling.
+//
+static const UINT16 s_attenuationPeriod = 0x0E0;
+
+//
+// Once the swing is down in the noise a step may read up to this many ADC
+// steps higher than the step before without it being taken as a failure.
+//
+static const int s_attenuationSlack = 4;
+
+//
+// Channel 2's period when it's used to clock the noise, a half of the
+// fastest fixed rate so a narrow periodic pulse isn't missed by the ADC.
+//
+static const UINT16 s_noiseCh2Period = 0x020;
+
+//
+// A measured frequency within this many percent of the expected passes.
+//
+static const UINT32 s_toneTolerancePercent = 3;
+
+
+CSN76489::CSN76489(
+    ICpu   *cpu,
+    UINT32 regWrite
+) : m_cpu(cpu),
+    m_regData(regWrite),
+    m_regWrite(regWrite)
+{
+}
+
+
+CSN76489::CSN76489(
+    ICpu   *cpu,
+    UINT32 regData,
+    UINT32 regWrite
+) : m_cpu(cpu),
+    m_regData(regData),
+    m_regWrite(regWrite)
+{
+}
+
+CSN76489::~CSN76489(
+)
+{
+}
+
+
+//
+// There's no reset input, so at power up the chip makes whatever noise its
+// registers happen to hold until this is called.
+//
+PERROR
+CSN76489::idle(
+)
+{
+    PERROR error = errorSuccess;
+
+    for (UINT8 channel = CH0 ; channel <= NOISE ; channel++)
+    {
+        error = write(SN_LATCH | (channel << SN_CHANNEL_SHIFT) | SN_ATTENUATION | SN_ATTENUATION_OFF);
+
+        if (FAILED(error))
+        {
+            break;
+        }
+    }
+
+    return error;
+}
+
+
+PERROR
+CSN76489::tone(
+    Channel channel,
+    UINT16  period,
+    UINT8   attenuation
+)
+{
+    PERROR error = errorSuccess;
+
+    error = write(SN_LATCH | (channel << SN_CHANNEL_SHIFT) | (period & 0x0F));
+
+    if (SUCCESS(error))
+    {
+        error = write((period >> 4) & 0x3F);
+    }
+
+    if (SUCCESS(error))
+    {
+        error = write(SN_LATCH | (channel << SN_CHANNEL_SHIFT) | SN_ATTENUATION | (attenuation & 0x0F));
+    }
+
+    return error;
+}
+
+
+//
+// Writing the noise control also resets the noise shift register.
+//
+PERROR
+CSN76489::noise(
+    bool       white,
+    NoiseShift shift,
+    UINT8      attenuation
+)
+{
+    PERROR error = errorSuccess;
+
+    error = write(SN_LATCH | (NOISE << SN_CHANNEL_SHIFT) | (white ? SN_NOISE_WHITE : 0) | shift);
+
+    if (SUCCESS(error))
+    {
+        error = write(SN_LATCH | (NOISE << SN_CHANNEL_SHIFT) | SN_ATTENUATION | (attenuation & 0x0F));
+    }
+
+    return error;
+}
+
+
+PERROR
+CSN76489::toneSweep(
+    UINT32 clockInHz,
+    UINT8  auxPin
+)
+{
+    PERROR error = errorSuccess;
+    UINT8 failChannel = 0;
+    UINT32 failExpected = 0;
+    UINT32 failReceived = 0;
+
+    error = idle();
+
+    for (UINT8 channel = CH0 ; SUCCESS(error) && (channel <= CH2) ; channel++)
+    {
+        for (UINT8 index = 0 ; index < ARRAYSIZE(s_tonePeriod) ; index++)
+        {
+            UINT16 period = s_tonePeriod[index];
+            UINT32 expected = (clockInHz + (16 * period)) / (32 * (UINT32) period);
+            UINT32 received = 0;
+            UINT32 tolerance = (expected * s_toneTolerancePercent) / 100;
+            bool pass;
+
+            error = tone((Channel) channel, period, 0);
+            if (FAILED(error))
+            {
+                break;
+            }
+
+            CAuxSignal::frequency(auxPin, &received);
+
+            pass = (received + tolerance >= expected) && (received <= expected + tolerance);
+
+            Serial.print("TONE,");
+            Serial.print(channel);
+            Serial.print(",");
+            Serial.print(period);
+            Serial.print(",");
+            Serial.print(expected);
+            Serial.print(",");
+            Serial.print(received);
+            Serial.println(pass ? ",PASS" : ",FAIL");
+
+            if (!pass && (failExpected == 0))
+            {
+                failChannel  = channel;
+                failExpected = expected;
+                failReceived = received;
+            }
+        }
+
+        if (SUCCESS(error))
+        {
+            error = tone((Channel) channel, 0, SN_ATTENUATION_OFF);
+        }
+    }
+
+    if (SUCCESS(error))
+    {
+        error = idle();
+    }
+
+    if (SUCCESS(error))
+    {
+        error = errorCustom;
+
+        if (failExpected == 0)
+        {
+            error->code = ERROR_SUCCESS;
+            stringCopy(error->description, "OK: Tone 012");
+        }
+        else
+        {
+            error->code = ERROR_FAILED;
+            stringCopy(error->description, "E:");
+            stringAppendHex(error->description, failChannel, 1);
+            stringAppend(error->description, " ");
+            stringAppendDec(error->description, failExpected);
+            stringAppend(error->description, "/");
+            stringAppendDec(error->description, failReceived);
+            stringAppend(error->description, "Hz");
+        }
+    }
+
+    return error;
+}
+
+
+//
+// Each attenuation step is 2dB, so the swing must fall at every step until
+// it's down in the noise. A stuck select bit repeats levels out of order - a
+// stuck bit 0 gives pairs of steps at the same level and a stuck higher bit
+// gives a run of levels that then rises back up - and either breaks the fall.
+//
+PERROR
+CSN76489::attenuationSweep(
+    UINT8 auxPin
+)
+{
+    PERROR error = errorSuccess;
+    bool failed = false;
+    UINT8 failChannel = 0;
+    UINT8 failAttenuation = 0;
+    int failSwing = 0;
+
+    error = idle();
+
+    for (UINT8 channel = CH0 ; SUCCESS(error) && (channel <= CH2) ; channel++)
+    {
+        int lastSwing = 0;
+
+        for (UINT8 attenuation = 0 ; attenuation <= SN_ATTENUATION_OFF ; attenuation++)
+        {
+            int minimum;
+            int maximum;
+            int swing;
+            bool pass;
+
+            error = tone((Channel) channel, s_attenuationPeriod, attenuation);
+            if (FAILED(error))
+            {
+                break;
+            }
+
+            CAuxSignal::levels(auxPin, &minimum, &maximum);
+            swing = maximum - minimum;
+
+            Serial.print("ATTEN,");
+            Serial.print(channel);
+            Serial.print(",");
+            Serial.print(attenuation);
+            Serial.print(",");
+            Serial.println(swing);
+
+            if (attenuation == 0)
+            {
+                pass = (swing >= CAuxSignal::c_minimumSwing);
+            }
+            else if (attenuation == SN_ATTENUATION_OFF)
+            {
+                pass = (swing < CAuxSignal::c_minimumSwing);
+            }
+            else if (lastSwing >= CAuxSignal::c_minimumSwing)
+            {
+                pass = (swing < lastSwing);
+            }
+            else
+            {
+                pass = (swing <= lastSwing + s_attenuationSlack);
+            }
+
+            if (!pass && !failed)
+            {
+                failed          = true;
+                failChannel     = channel;
+                failAttenuation = attenuation;
+                failSwing       = swing;
+            }
+
+            lastSwing = swing;
+        }
+    }
+
+    if (SUCCESS(error))
+    {
+        error = idle();
+    }
+
+    if (SUCCESS(error))
+    {
+        error = errorCustom;
+
+        if (!failed)
+        {
+            error->code = ERROR_SUCCESS;
+            stringCopy(error->description, "OK: Atten 012");
+        }
+        else
+        {
+            error->code = ERROR_FAILED;
+            stringCopy(error->description, "E:Ch");
+            stringAppendHex(error->description, failChannel, 1);
+            stringAppend(error->description, " Att");
+            stringAppendHex(error->description, failAttenuation, 1);
+            stringAppend(error->description, " ");
+            stringAppendDec(error->description, failSwing);
+        }
+    }
+
+    return error;
+}
+
+
+PERROR
+CSN76489::noiseModes(
+    UINT8 auxPin
+)
+{
+    PERROR error = errorSuccess;
+    bool failed = false;
+    bool failWhite = false;
+    UINT8 failShift = 0;
+    int failSwing = 0;
+
+    error = idle();
+
+    // Channel 2 stays silent but still clocks the noise for SHIFT_CH2.
+    if (SUCCESS(error))
+    {
+        error = tone(CH2, s_noiseCh2Period, SN_ATTENUATION_OFF);
+    }
+
+    for (UINT8 mode = 0 ; SUCCESS(error) && (mode < 8) ; mode++)
+    {
+        bool white = (mode >= 4);
+        NoiseShift shift = (NoiseShift) (mode & 0x3);
+        int minimum;
+        int maximum;
+        int swing;
+        bool pass;
+
+        error = noise(white, shift, 0);
+        if (FAILED(error))
+        {
+            break;
+        }
+
+        CAuxSignal::levels(auxPin, &minimum, &maximum);
+        swing = maximum - minimum;
+        pass  = (swing >= CAuxSignal::c_minimumSwing);
+
+        Serial.print("NOISE,");
+        Serial.print(white ? "W," : "P,");
+        Serial.print(shift);
+        Serial.print(",");
+        Serial.print(swing);
+        Serial.println(pass ? ",PASS" : ",FAIL");
+
+        if (!pass && !failed)
+        {
+            failed    = true;
+            failWhite = white;
+            failShift = shift;
+            failSwing = swing;
+        }
+    }
+
+    if (SUCCESS(error))
+    {
+        error = idle();
+    }
+
+    if (SUCCESS(error))
+    {
+        error = errorCustom;
+
+        if (!failed)
+        {
+            error->code = ERROR_SUCCESS;
+            stringCopy(error->description, "OK: Noise");
+        }
+        else
+        {
+            error->code = ERROR_FAILED;
+            stringCopy(error->description, failWhite ? "E:Noise W" : "E:Noise P");
+            stringAppendHex(error->description, failShift, 1);
+            stringAppend(error->description, " ");
+            stringAppendDec(error->description, failSwing);
+        }
+    }
+
+    return error;
+}
+
+
+//
+// When the data is held in a separate latch the write enable strobe is a
+// dummy write to its own location.
+//
+PERROR
+CSN76489::write(
+    UINT8 data
+)
+{
+    PERROR error = errorSuccess;
+
+    error = m_cpu->memoryWrite(m_regData, (UINT16) data);
+
+    if (SUCCESS(error) && (m_regWrite != m_regData))
+    {
+        error = m_cpu->memoryWrite(m_regWrite, 0x00);
+    }
+
+    return error;
+}
+
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CSN76489_h
+#define CSN76489_h
+
+#include "ICpu.h"
+
+
+//
+// Implementation for testing the SN76489 (and SN76496) programmable sound
+// generator. The device is write only, each register update being a latch
+// byte optionally followed by a data byte. All four channels are mixed onto
+// the one analog output.
+//
+class CSN76489 : public CArenaObject
+{
+    public:
+
+        //
+        // The SN76489 has three tone channels & a noise channel.
+        //
+        typedef enum {
+            CH0,
+            CH1,
+            CH2,
+            NOISE
+        } Channel;
+
+        //
+        // The noise shift rate is a fixed division of the clock or follows
+        // the tone period of channel 2.
+        //
+        typedef enum {
+            SHIFT_512,
+            SHIFT_1024,
+            SHIFT_2048,
+            SHIFT_CH2
+        } NoiseShift;
+
+        //
+        // For a chip wired directly to the bus, written with one location.
+        //
+        CSN76489(
+            ICpu   *cpu,
+            UINT32 regWrite
+        );
+
+        //
+        // For a chip with its data held in a latch at one location and the
+        // write enable strobed by an access to the other.
+        //
+        CSN76489(
+            ICpu   *cpu,
+            UINT32 regData,
+            UINT32 regWrite
+        );
+
+        ~CSN76489(
+        );
+
+        //
+        // Set all the channels to full attenuation (silent).
+        //
+        PERROR idle(
+        );
+
+        //
+        // Set the 10-bit period of a tone channel and its 4-bit attenuation,
+        // 2dB per step with 0xF being off.
+        //
+        PERROR tone(
+            Channel channel,
+            UINT16  period,
+            UINT8   attenuation
+        );
+
+        PERROR noise(
+            bool       white,
+            NoiseShift shift,
+            UINT8      attenuation
+        );
+
+        //
+        // Sweep each tone channel in turn through a set of periods and
+        // measure the frequency of the output on the given J14 AUX pin. The
+        // expected frequency is the clock / (32 x period).
+        //
+        // Each measurement is sent to the serial port as a line of
+        // "TONE,channel,period,expected Hz,received Hz,PASS|FAIL".
+        //
+        PERROR toneSweep(
+            UINT32 clockInHz,
+            UINT8  auxPin
+        );
+
+        //
+        // Step each tone channel in turn through all the attenuations and
+        // check the output swing falls with each step, ending in silence.
+        // The swing (in ADC steps) is sent to the serial port as a line of
+        // "ATTEN,channel,attenuation,swing".
+        //
+        PERROR attenuationSweep(
+            UINT8 auxPin
+        );
+
+        //
+        // Run each noise mode and check there's an output. The noise isn't
+        // a frequency that can be compared so only the swing is reported as
+        // a line of "NOISE,P|W,shift,swing,PASS|FAIL".
+        //
+        PERROR noiseModes(
+            UINT8 auxPin
+        );
+
+    private:
+
+        PERROR write(
+            UINT8 data
+        );
+
+    private:
+
+        ICpu    *m_cpu;
+        UINT32  m_regData;
+        UINT32  m_regWrite;
+};
+
+#endif
+
@@ -142,7 +142,7 @@ CSystem2BaseGame::interruptCheck(
     PERROR error = errorSuccess;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "OK:";
+    stringCopy(errorCustom->description, "OK:");
 
     // Enable the VBLANK interrupt
     error = m_cpu->memoryWrite(s_irqEnableAddress, 0x8);
@@ -331,6 +331,7 @@ CT11Cpu::memoryReadWrite(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
     UINT16 data16 = 0;
 
     // Before processing anything, perform any address remapping.
@@ -482,9 +483,10 @@ CT11Cpu::memoryReadWrite(
         }
     }
 
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
 
     *data = data16;
@@ -499,6 +501,8 @@ CT11Cpu::memoryRead(
     UINT16  *data
 )
 {
+    BUS_STATS_INC(reads);
+
     return memoryReadWrite(address, data, (UINT8*) NULL, true);
 }
 
@@ -509,6 +513,8 @@ CT11Cpu::memoryWrite(
     UINT16 data
 )
 {
+    BUS_STATS_INC(writes);
+
     return memoryReadWrite(address, &data, (UINT8*) NULL, false);
 }
 
@@ -163,7 +163,7 @@ CCrazyKongBaseGame::interruptCheck(
     PERROR error = errorSuccess;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "OK:";
+    stringCopy(errorCustom->description, "OK:");
 
     for (int i = 0 ; i < 4 ; i++)
     {
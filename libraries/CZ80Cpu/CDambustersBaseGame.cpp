@@ -191,7 +191,7 @@ CDambustersBaseGame::interruptCheck(
     PERROR error = errorSuccess;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "OK:";
+    stringCopy(errorCustom->description, "OK:");
 
     for (int i = 0 ; i < 4 ; i++)
     {
@@ -351,8 +351,8 @@ CDambustersBaseGame::nvRamCrc(
         error = errorCustom;
 
         error->code = ERROR_SUCCESS;
-        error->description = "OK:";
-        error->description += nvRamRegion.location;
+        stringCopy(error->description, "OK:");
+        stringAppend(error->description, nvRamRegion.location);
         STRING_UINT32_HEX(error->description, crc);
     }
 
@@ -95,6 +95,7 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                  "0123456789"
                                                             {CFitterSoundBaseGame::ayIdle,      "AY Idle   "},
                                                             {CFitterSoundBaseGame::ayCheck,     "AY Check  "},
+                                                            {CFitterSoundBaseGame::ayRegisters, "AY Regs   "},
                                                             {CFitterSoundBaseGame::ay_8_ChA,    "AY 8 CHA  "},
                                                             {CFitterSoundBaseGame::ay_8_ChB,    "AY 8 CHB  "},
                                                             {CFitterSoundBaseGame::ay_8_ChC,    "AY 8 CHC  "},
@@ -179,6 +180,18 @@ CFitterSoundBaseGame::ayCheck(
 }
 
 
+// Walking bit & uniqueness check of the AY-3-8910's registers.
+PERROR
+CFitterSoundBaseGame::ayRegisters(
+    void *cFitterSoundBaseGame
+)
+{
+    CFitterSoundBaseGame *pThis = (CFitterSoundBaseGame *) cFitterSoundBaseGame;
+
+    return pThis->m_ay->registers();
+}
+
+
 PERROR
 CFitterSoundBaseGame::ay_8_ChA(
     void *cFitterSoundBaseGame
@@ -48,6 +48,10 @@ class CFitterSoundBaseGame : public CGame
             void *cFitterSoundBaseGame
         );
 
+        static PERROR ayRegisters(
+            void *cFitterSoundBaseGame
+        );
+
         static PERROR ay_8_ChA(
             void *cFitterSoundBaseGame
         );
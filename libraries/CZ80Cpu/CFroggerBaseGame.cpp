@@ -178,7 +178,7 @@ CFroggerBaseGame::interruptCheck(
     UINT8 response = 0;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "OK:";
+    stringCopy(errorCustom->description, "OK:");
 
     for (int i = 0 ; i < 4 ; i++)
     {
@@ -117,6 +117,7 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                    "0123456789"
                                                             {CFroggerSoundBaseGame::ayIdle,       "AY Idle   "},
                                                             {CFroggerSoundBaseGame::ayCheck,      "AY Check  "},
+                                                            {CFroggerSoundBaseGame::ayRegisters,  "AY Regs   "},
                                                             {CFroggerSoundBaseGame::ay_35_ChA,    "AY 35 CHA "},
                                                             {CFroggerSoundBaseGame::ay_35_ChB,    "AY 35 CHB "},
                                                             {CFroggerSoundBaseGame::ay_35_ChC,    "AY 35 CHC "},
@@ -201,6 +202,18 @@ CFroggerSoundBaseGame::ayCheck(
 }
 
 
+// Walking bit & uniqueness check of the AY-3-8910's registers.
+PERROR
+CFroggerSoundBaseGame::ayRegisters(
+    void *cFroggerSoundBaseGame
+)
+{
+    CFroggerSoundBaseGame *pThis = (CFroggerSoundBaseGame *) cFroggerSoundBaseGame;
+
+    return pThis->m_ay->registers();
+}
+
+
 PERROR
 CFroggerSoundBaseGame::ay_35_ChA(
     void *cFroggerSoundBaseGame
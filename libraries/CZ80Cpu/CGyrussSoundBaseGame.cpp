@@ -88,6 +88,7 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                  "0123456789"
                                                             {CGyrussSoundBaseGame::ayIdle,      "AY Idle   "},
                                                             {CGyrussSoundBaseGame::ayCheck,     "AY Check  "},
+                                                            {CGyrussSoundBaseGame::ayRegisters, "AY Regs   "},
                                                             {CGyrussSoundBaseGame::ayNoise,     "AY Noise  "},
                                                             {NO_CUSTOM_FUNCTION}}; // end of list
 
@@ -232,6 +233,37 @@ CGyrussSoundBaseGame::ayCheck(
 }
 
 
+// Walking bit & uniqueness check of the AY-3-8910's registers.
+PERROR
+CGyrussSoundBaseGame::ayRegisters(
+    void *cGyrussSoundBaseGame
+)
+{
+    CGyrussSoundBaseGame *pThis = (CGyrussSoundBaseGame *) cGyrussSoundBaseGame;
+    PERROR error = errorSuccess;
+
+    error = pThis->m_ay[0]->registers();
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[1]->registers();
+    }
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[2]->registers();
+    }
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[3]->registers();
+    }
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[4]->registers();
+    }
+
+    return error;
+}
+
+
 // Noise test the AY-3-8910's.
 PERROR
 CGyrussSoundBaseGame::ayNoise(
@@ -48,6 +48,10 @@ class CGyrussSoundBaseGame : public CGame
             void *cGyrussSoundBaseGame
         );
 
+        static PERROR ayRegisters(
+            void *cGyrussSoundBaseGame
+        );
+
         static PERROR ayNoise(
             void *cGyrussSoundBaseGame
         );
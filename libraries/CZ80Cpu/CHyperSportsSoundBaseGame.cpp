@@ -48,6 +48,9 @@ static const UINT32 s_dacAddress        = 0xe000L;
 static const UINT32 s_psgCommandAddress = 0xe001L;
 static const UINT32 s_psgTriggerAddress = 0xe002L;
 
+// The SN76489 is clocked at 14.318MHz / 8
+static const UINT32 s_psgClockInHz      = 1789772L;
+
 //
 // RAM region is the same for all games on this board set.
 //
@@ -92,9 +95,12 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 // Custom functions implemented for this game.
 //
-static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                       "0123456789"
-                                                            {CHyperSportsSoundBaseGame::testDAC,     "Test DAC  "},
-                                                            {CHyperSportsSoundBaseGame::testSN76489, "Test 76489"},
+static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                              "0123456789"
+                                                            {CHyperSportsSoundBaseGame::testDAC,            "Test DAC  "},
+                                                            {CHyperSportsSoundBaseGame::testSN76489,        "Test 76489"},
+                                                            {CHyperSportsSoundBaseGame::snToneSweep,        "SN Tones  "},
+                                                            {CHyperSportsSoundBaseGame::snAttenuationSweep, "SN Atten  "},
+                                                            {CHyperSportsSoundBaseGame::snNoiseModes,       "SN Noise  "},
                                                             {NO_CUSTOM_FUNCTION}}; // end of list
 
 
@@ -126,8 +132,11 @@ CHyperSportsSoundBaseGame::CHyperSportsSoundBaseGame(
     // There is no direct hardware response of a vector on this platform.
     m_interruptAutoVector = true;
 
+    // The command is latched and then written by the trigger.
+    m_sn76489 = new CSN76489(m_cpu, s_psgCommandAddress, s_psgTriggerAddress);
+
     // Clear the sound generator to silent
-    (void) clearSN76489(m_cpu);
+    (void) m_sn76489->idle();
 
 }
 
@@ -135,6 +144,9 @@ CHyperSportsSoundBaseGame::CHyperSportsSoundBaseGame(
 CHyperSportsSoundBaseGame::~CHyperSportsSoundBaseGame(
 )
 {
+    delete m_sn76489;
+    m_sn76489 = (CSN76489 *) NULL;
+
     delete m_cpu;
     m_cpu = (ICpu *) NULL;
 }
@@ -184,7 +196,7 @@ CHyperSportsSoundBaseGame::testDAC(
 
 
 //
-// Test the SN76489 tone generator
+// Test the SN76489 tone generator by ear, channel 0 for 5 seconds.
 //
 PERROR
 CHyperSportsSoundBaseGame::testSN76489(
@@ -192,57 +204,58 @@ CHyperSportsSoundBaseGame::testSN76489(
 )
 {
     CHyperSportsSoundBaseGame *thisGame = (CHyperSportsSoundBaseGame *) context;
-    ICpu *cpu = thisGame->m_cpu;
     PERROR error = errorSuccess;
 
-    // Channel 0 - Tone - Lo
-    (void) cpu->memoryWrite(s_psgCommandAddress, 0x80);
-    (void) cpu->memoryWrite(s_psgTriggerAddress, 0x00);
+    error = thisGame->m_sn76489->tone(CSN76489::CH0, 0x0F0, 0x0);
 
-    // Channel 0 - Tone - Hi
-    (void) cpu->memoryWrite(s_psgCommandAddress, 0x0F);
-    (void) cpu->memoryWrite(s_psgTriggerAddress, 0x00);
-
-    // Channel 0 - Amplitude
-    (void) cpu->memoryWrite(s_psgCommandAddress, 0x90);
-    (void) cpu->memoryWrite(s_psgTriggerAddress, 0x00);
-
-    // wait 5 seconds
-    delay(5000);
+    if (SUCCESS(error))
+    {
+        delay(5000);
+    }
 
     // Clear back to silent
-    error = thisGame->clearSN76489(cpu);
+    {
+        PERROR idleError = thisGame->m_sn76489->idle();
+
+        if (SUCCESS(error))
+        {
+            error = idleError;
+        }
+    }
 
     return error;
 }
 
 
 //
-// Test the SN76489 tone generator
+// The SN76489 output (pin 7) is probed on AUX 1 for these.
 //
 PERROR
-CHyperSportsSoundBaseGame::clearSN76489(
-    ICpu *cpu
+CHyperSportsSoundBaseGame::snToneSweep(
+    void *context
 )
 {
-    PERROR error = errorSuccess;
-
-    // Channel 0 - Clear
-    (void) cpu->memoryWrite(s_psgCommandAddress, 0x9F);
-    (void) cpu->memoryWrite(s_psgTriggerAddress, 0x00);
+    CHyperSportsSoundBaseGame *thisGame = (CHyperSportsSoundBaseGame *) context;
+    return thisGame->m_sn76489->toneSweep(s_psgClockInHz, 1);
+}
 
-    // Channel 1 - Clear
-    (void) cpu->memoryWrite(s_psgCommandAddress, 0xBF);
-    (void) cpu->memoryWrite(s_psgTriggerAddress, 0x00);
 
-    // Channel 2 - Clear
-    (void) cpu->memoryWrite(s_psgCommandAddress, 0xDF);
-    (void) cpu->memoryWrite(s_psgTriggerAddress, 0x00);
+PERROR
+CHyperSportsSoundBaseGame::snAttenuationSweep(
+    void *context
+)
+{
+    CHyperSportsSoundBaseGame *thisGame = (CHyperSportsSoundBaseGame *) context;
+    return thisGame->m_sn76489->attenuationSweep(1);
+}
 
-    // Channel 3 - Clear
-    (void) cpu->memoryWrite(s_psgCommandAddress, 0xFF);
-    (void) cpu->memoryWrite(s_psgTriggerAddress, 0x00);
 
-    return error;
+PERROR
+CHyperSportsSoundBaseGame::snNoiseModes(
+    void *context
+)
+{
+    CHyperSportsSoundBaseGame *thisGame = (CHyperSportsSoundBaseGame *) context;
+    return thisGame->m_sn76489->noiseModes(1);
 }
 
@@ -26,6 +26,7 @@
 #define CHyperSportsSoundBaseGame_h
 
 #include "CGame.h"
+#include "CSN76489.h"
 
 
 class CHyperSportsSoundBaseGame : public CGame
@@ -53,6 +54,22 @@ class CHyperSportsSoundBaseGame : public CGame
             void *context
         );
 
+        //
+        // Custom functions to sweep the SN76489 tones & attenuation and run
+        // the noise modes, measuring the output on AUX 1.
+        //
+        static PERROR snToneSweep(
+            void *context
+        );
+
+        static PERROR snAttenuationSweep(
+            void *context
+        );
+
+        static PERROR snNoiseModes(
+            void *context
+        );
+
     protected:
 
         CHyperSportsSoundBaseGame(
@@ -65,9 +82,7 @@ class CHyperSportsSoundBaseGame : public CGame
 
     private:
 
-        PERROR clearSN76489(
-            ICpu *cpu
-        );
+        CSN76489  *m_sn76489;
 
 };
 
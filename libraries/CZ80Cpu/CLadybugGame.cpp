@@ -48,8 +48,8 @@ static const ROM_REGION s_romRegionSet1[] PROGMEM = { //
                                                       {NO_BANK_SWITCH, 0x1000, 0x1000, s_romData2nSet1[1].data2n, 0x88bc4a0a, " D4"}, // l2.d4
                                                       {NO_BANK_SWITCH, 0x2000, 0x1000, s_romData2nSet1[2].data2n, 0x53e9efce, " E4"}, // l3.e4
                                                       {NO_BANK_SWITCH, 0x3000, 0x1000, s_romData2nSet1[3].data2n, 0xffc424d7, " H4"}, // l4.h4
-                                                      {NO_BANK_SWITCH, 0x4000, 0x1000, s_romData2nSet1[3].data2n, 0xad6af809, " J4"}, // l5.j4
-                                                      {NO_BANK_SWITCH, 0x5000, 0x1000, s_romData2nSet1[3].data2n, 0xcf1acca4, " K4"}, // l6.k4
+                                                      {NO_BANK_SWITCH, 0x4000, 0x1000, s_romData2nSet1[4].data2n, 0xad6af809, " J4"}, // l5.j4
+                                                      {NO_BANK_SWITCH, 0x5000, 0x1000, s_romData2nSet1[5].data2n, 0xcf1acca4, " K4"}, // l6.k4
                                                       {0} }; // end of list
 
 //
@@ -72,8 +72,8 @@ static const ROM_REGION s_romRegionSet2[] PROGMEM = { //
                                                       {NO_BANK_SWITCH, 0x1000, 0x1000, s_romData2nSet2[1].data2n, 0x5ce5b950, " D4"}, // 2.d4
                                                       {NO_BANK_SWITCH, 0x2000, 0x1000, s_romData2nSet2[2].data2n, 0xbc28218d, " E4"}, // 3.e4
                                                       {NO_BANK_SWITCH, 0x3000, 0x1000, s_romData2nSet2[3].data2n, 0x2b32e9f5, " H4"}, // 4.h4
-                                                      {NO_BANK_SWITCH, 0x4000, 0x1000, s_romData2nSet2[3].data2n, 0xd117153e, " J4"}, // 5.j4
-                                                      {NO_BANK_SWITCH, 0x5000, 0x1000, s_romData2nSet2[3].data2n, 0xc7d366cb, " K4"}, // 6.k4
+                                                      {NO_BANK_SWITCH, 0x4000, 0x1000, s_romData2nSet2[4].data2n, 0xd117153e, " J4"}, // 5.j4
+                                                      {NO_BANK_SWITCH, 0x5000, 0x1000, s_romData2nSet2[5].data2n, 0xc7d366cb, " K4"}, // 6.k4
                                                        {0} }; // end of list
 
 IGame*
@@ -99,12 +99,14 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 // Custom functions implemented for this game.
 //
-static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                 "0123456789"
-                                                            {CMegaZoneSoundBaseGame::ayIdle,   "AY Idle   "},
-                                                            {CMegaZoneSoundBaseGame::ayCheck,  "AY Check  "},
-                                                            {CMegaZoneSoundBaseGame::ayChA,    "AY CHA    "},
-                                                            {CMegaZoneSoundBaseGame::ayChB,    "AY CHB    "},
-                                                            {CMegaZoneSoundBaseGame::ayChC,    "AY CHC    "},
+static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                    "0123456789"
+                                                            {CMegaZoneSoundBaseGame::ayIdle,      "AY Idle   "},
+                                                            {CMegaZoneSoundBaseGame::ayCheck,     "AY Check  "},
+                                                            {CMegaZoneSoundBaseGame::ayRegisters, "AY Regs   "},
+                                                            {CMegaZoneSoundBaseGame::ayTone,      "AY Tone   "},
+                                                            {CMegaZoneSoundBaseGame::ayChA,       "AY CHA    "},
+                                                            {CMegaZoneSoundBaseGame::ayChB,       "AY CHB    "},
+                                                            {CMegaZoneSoundBaseGame::ayChC,       "AY CHC    "},
                                                             {NO_CUSTOM_FUNCTION}}; // end of list
 
 
@@ -186,6 +188,32 @@ CMegaZoneSoundBaseGame::ayCheck(
 }
 
 
+// Walking bit & uniqueness check of the AY-3-8910's registers.
+PERROR
+CMegaZoneSoundBaseGame::ayRegisters(
+    void *cMegaZoneSoundBaseGame
+)
+{
+    CMegaZoneSoundBaseGame *pThis = (CMegaZoneSoundBaseGame *) cMegaZoneSoundBaseGame;
+    return pThis->m_ay->registers();
+}
+
+
+//
+// Measure the tone frequencies with the AY channel outputs probed
+// on AUX 1 (CHA), 2 (CHB) & 3 (CHC). The AY is clocked at 1.79MHz.
+//
+PERROR
+CMegaZoneSoundBaseGame::ayTone(
+    void *cMegaZoneSoundBaseGame
+)
+{
+    static const UINT32 ayClockInHz = 1789772L;
+    CMegaZoneSoundBaseGame *pThis = (CMegaZoneSoundBaseGame *) cMegaZoneSoundBaseGame;
+    return pThis->m_ay->tones(ayClockInHz, 1);
+}
+
+
 PERROR
 CMegaZoneSoundBaseGame::ayChA(
     void *cMegaZoneSoundBaseGame
@@ -48,6 +48,14 @@ class CMegaZoneSoundBaseGame : public CGame
             void *cMegaZoneSoundBaseGame
         );
 
+        static PERROR ayRegisters(
+            void *cMegaZoneSoundBaseGame
+        );
+
+        static PERROR ayTone(
+            void *cMegaZoneSoundBaseGame
+        );
+
         static PERROR ayChA(
             void *cMegaZoneSoundBaseGame
         );
@@ -149,21 +149,22 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 //
 // Custom functions implemented for this game.
 //
-static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                   "0123456789"
-                                                            {CScorpionSoundBaseGame::ayIdle,     "AY Idle   "},
-                                                            {CScorpionSoundBaseGame::ayCheckAll, "AY Chk All"},
-                                                            {CScorpionSoundBaseGame::ayCheck0,   "AY Chk 37 "},
-                                                            {CScorpionSoundBaseGame::ayCheck1,   "AY Chk 36 "},
-                                                            {CScorpionSoundBaseGame::ayCheck2,   "AY Chk 35 "},
-                                                            {CScorpionSoundBaseGame::ay0_ChA,    "AY 37 CHA "},
-                                                            {CScorpionSoundBaseGame::ay0_ChB,    "AY 37 CHB "},
-                                                            {CScorpionSoundBaseGame::ay0_ChC,    "AY 37 CHC "},
-                                                            {CScorpionSoundBaseGame::ay1_ChA,    "AY 36 CHA "},
-                                                            {CScorpionSoundBaseGame::ay1_ChB,    "AY 36 CHB "},
-                                                            {CScorpionSoundBaseGame::ay1_ChC,    "AY 36 CHC "},
-                                                            {CScorpionSoundBaseGame::ay2_ChA,    "AY 35 CHA "},
-                                                            {CScorpionSoundBaseGame::ay2_ChB,    "AY 35 CHB "},
-                                                            {CScorpionSoundBaseGame::ay2_ChC,    "AY 35 CHC "},
+static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                    "0123456789"
+                                                            {CScorpionSoundBaseGame::ayIdle,      "AY Idle   "},
+                                                            {CScorpionSoundBaseGame::ayCheckAll,  "AY Chk All"},
+                                                            {CScorpionSoundBaseGame::ayCheck0,    "AY Chk 37 "},
+                                                            {CScorpionSoundBaseGame::ayCheck1,    "AY Chk 36 "},
+                                                            {CScorpionSoundBaseGame::ayCheck2,    "AY Chk 35 "},
+                                                            {CScorpionSoundBaseGame::ayRegisters, "AY Regs   "},
+                                                            {CScorpionSoundBaseGame::ay0_ChA,     "AY 37 CHA "},
+                                                            {CScorpionSoundBaseGame::ay0_ChB,     "AY 37 CHB "},
+                                                            {CScorpionSoundBaseGame::ay0_ChC,     "AY 37 CHC "},
+                                                            {CScorpionSoundBaseGame::ay1_ChA,     "AY 36 CHA "},
+                                                            {CScorpionSoundBaseGame::ay1_ChB,     "AY 36 CHB "},
+                                                            {CScorpionSoundBaseGame::ay1_ChC,     "AY 36 CHC "},
+                                                            {CScorpionSoundBaseGame::ay2_ChA,     "AY 35 CHA "},
+                                                            {CScorpionSoundBaseGame::ay2_ChB,     "AY 35 CHB "},
+                                                            {CScorpionSoundBaseGame::ay2_ChC,     "AY 35 CHC "},
                                                             {NO_CUSTOM_FUNCTION}}; // end of list
 
 
@@ -273,6 +274,29 @@ CScorpionSoundBaseGame::ayCheckAll(
 }
 
 
+// Walking bit & uniqueness check of the AY-3-8910's registers.
+PERROR
+CScorpionSoundBaseGame::ayRegisters(
+    void *cScorpionSoundBaseGame
+)
+{
+    CScorpionSoundBaseGame *pThis = (CScorpionSoundBaseGame *) cScorpionSoundBaseGame;
+    PERROR error = errorSuccess;
+
+    error = pThis->m_ay[0]->registers();
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[1]->registers();
+    }
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[2]->registers();
+    }
+
+    return error;
+}
+
+
 // Check (test) the AY-3-8910's.
 PERROR
 CScorpionSoundBaseGame::ayCheck0(
@@ -48,6 +48,10 @@ class CScorpionSoundBaseGame : public CGame
             void *cScorpionSoundBaseGame
         );
 
+        static PERROR ayRegisters(
+            void *cScorpionSoundBaseGame
+        );
+
         static PERROR ayCheck0(
             void *cScorpionSoundBaseGame
         );
@@ -181,11 +181,7 @@ CScrambleBaseGame::CScrambleBaseGame(
             m_8255WriteBaseAddress0 += s_hustlerScrambleBaseOffset;
             m_8255WriteBaseAddress1 += s_hustlerScrambleBaseOffset;
 
-            addAddressOffset(m_ramRegion,          s_hustlerScrambleBaseOffset);
-            addAddressOffset(m_ramRegionByteOnly,  s_hustlerScrambleBaseOffset);
-            addAddressOffset(m_ramRegionWriteOnly, s_hustlerScrambleBaseOffset);
-            addAddressOffset(m_inputRegion,        s_hustlerScrambleBaseOffset);
-            addAddressOffset(m_outputRegion,       s_hustlerScrambleBaseOffset);
+            addAddressOffset(s_hustlerScrambleBaseOffset);
         }
 
         case SCRAMBLE :
@@ -249,7 +245,7 @@ CScrambleBaseGame::interruptCheck(
     UINT8 response = 0;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "OK:";
+    stringCopy(errorCustom->description, "OK:");
 
     for (int i = 0 ; i < 4 ; i++)
     {
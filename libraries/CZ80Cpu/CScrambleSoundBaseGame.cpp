@@ -110,6 +110,11 @@ static const UINT32 AY_FLT_3D_CHB_AV9  = 0x09200L;
 static const UINT32 AY_FLT_3D_CHC_AV10 = 0x09400L;
 static const UINT32 AY_FLT_3D_CHC_AV11 = 0x09800L;
 
+//
+// The AY clock (14.318MHz / 8) used for the expected tone frequencies.
+//
+static const UINT32 AY_CLOCK_IN_HZ     = 1789772L;
+
 //
 // Output region is the same for all versions on this board set.
 //
@@ -140,6 +145,9 @@ static const OUTPUT_REGION s_outputRegion[] PROGMEM = { //
 static const CUSTOM_FUNCTION s_customFunction[] PROGMEM = { //                                    "0123456789"
                                                             {CScrambleSoundBaseGame::ayIdle,      "AY Idle   "},
                                                             {CScrambleSoundBaseGame::ayCheck,     "AY Check  "},
+                                                            {CScrambleSoundBaseGame::ayRegisters, "AY Regs   "},
+                                                            {CScrambleSoundBaseGame::ay_3D_Tone,  "AY 3D Tone"},
+                                                            {CScrambleSoundBaseGame::ay_3C_Tone,  "AY 3C Tone"},
                                                             {CScrambleSoundBaseGame::ay_3D_ChA,   "AY 3D CHA "},
                                                             {CScrambleSoundBaseGame::ay_3D_ChB,   "AY 3D CHB "},
                                                             {CScrambleSoundBaseGame::ay_3D_ChC,   "AY 3D CHC "},
@@ -241,6 +249,67 @@ CScrambleSoundBaseGame::ayCheck(
 }
 
 
+// Walking bit & uniqueness check of the AY-3-8910's registers.
+PERROR
+CScrambleSoundBaseGame::ayRegisters(
+    void *cScrambleSoundBaseGame
+)
+{
+    CScrambleSoundBaseGame *pThis = (CScrambleSoundBaseGame *) cScrambleSoundBaseGame;
+    PERROR error = errorSuccess;
+
+    error = pThis->m_ay[0]->registers();
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[1]->registers();
+    }
+
+    return error;
+}
+
+
+//
+// Measure the tone frequencies of the AY at 3D with the channel
+// outputs CHA (pin 4), CHB (pin 3) & CHC (pin 38) probed on AUX 1, 2 & 3.
+// The filters are turned off so they don't attenuate the tone.
+//
+PERROR
+CScrambleSoundBaseGame::ay_3D_Tone(
+    void *cScrambleSoundBaseGame
+)
+{
+    CScrambleSoundBaseGame *pThis = (CScrambleSoundBaseGame *) cScrambleSoundBaseGame;
+    PERROR error = errorSuccess;
+
+    error = pThis->m_cpu->memoryWrite(AY_FLT_OFF, 0);
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[0]->tones(AY_CLOCK_IN_HZ, 1);
+    }
+
+    return error;
+}
+
+
+// As above for the AY at 3C.
+PERROR
+CScrambleSoundBaseGame::ay_3C_Tone(
+    void *cScrambleSoundBaseGame
+)
+{
+    CScrambleSoundBaseGame *pThis = (CScrambleSoundBaseGame *) cScrambleSoundBaseGame;
+    PERROR error = errorSuccess;
+
+    error = pThis->m_cpu->memoryWrite(AY_FLT_OFF, 0);
+    if (SUCCESS(error))
+    {
+        error = pThis->m_ay[1]->tones(AY_CLOCK_IN_HZ, 1);
+    }
+
+    return error;
+}
+
+
 PERROR
 CScrambleSoundBaseGame::ay_3D_ChA(
     void *cScrambleSoundBaseGame
@@ -48,6 +48,18 @@ class CScrambleSoundBaseGame : public CGame
             void *cScrambleSoundBaseGame
         );
 
+        static PERROR ayRegisters(
+            void *cScrambleSoundBaseGame
+        );
+
+        static PERROR ay_3D_Tone(
+            void *cScrambleSoundBaseGame
+        );
+
+        static PERROR ay_3C_Tone(
+            void *cScrambleSoundBaseGame
+        );
+
         static PERROR ay_3D_ChA(
             void *cScrambleSoundBaseGame
         );
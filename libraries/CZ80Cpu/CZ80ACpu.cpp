@@ -238,6 +238,17 @@ static const UINT8 s_D7_BIT_D7        = 0x80;
 #define IS_WAIT_SPACE(ad) ((ad & (UINT32) 0x100000) != 0)
 #define IS_SYNC_SPACE(ad) ((ad & (UINT32) 0x200000) != 0)
 
+//
+// The address space window index into the bus cycle dispatch tables.
+// The IO (bit 16), WAIT (bit 20) & SYNC (bit 21) bits are packed into bits 0..2.
+//
+static const UINT8 s_WINDOW_IO   = 0x01;
+static const UINT8 s_WINDOW_WAIT = 0x02;
+static const UINT8 s_WINDOW_SYNC = 0x04;
+
+#define ADDRESS_WINDOW(ad) ( (((UINT8) (ad >> 16)) & 0x01) |        \
+                             ((((UINT8) (ad >> 16)) >> 3) & 0x06) )
+
 
 //
 // Control Pins
@@ -312,6 +323,50 @@ CZ80ACpu::CZ80ACpu(
     m_dataRemapCallbackContext(dataRemapCallbackContext),
     m_cycleType(cycleType)
 {
+    //
+    // Resolve the bus cycle for each address space window up front so that
+    // each access is a single indirect call rather than a chain of tests.
+    // The WAIT space pre-synchronization replaces the clock edge sync
+    // used for the default cycle type.
+    //
+    for (UINT8 window = 0 ; window < ARRAYSIZE(m_readCycle) ; window++)
+    {
+        bool clkSync = (m_cycleType == CYCLE_TYPE_DEFAULT) && !(window & s_WINDOW_WAIT);
+
+        if (window & s_WINDOW_IO)
+        {
+            m_readCycle[window]  = clkSync ? IORQreadClk  : IORQread;
+            m_writeCycle[window] = clkSync ? IORQwriteClk : IORQwrite;
+        }
+        else if (m_cycleType == CYCLE_TYPE_PUCKMAN)
+        {
+            m_readCycle[window]  = MREQreadPuckman;
+            m_writeCycle[window] = MREQwritePuckman;
+        }
+        else if (m_cycleType == CYCLE_TYPE_CRAZYKONG)
+        {
+            if (window & s_WINDOW_SYNC)
+            {
+                m_readCycle[window]  = MREQreadCrazyKongSync;
+                m_writeCycle[window] = MREQwriteCrazyKongSync;
+            }
+            else
+            {
+                m_readCycle[window]  = MREQreadCrazyKong;
+                m_writeCycle[window] = MREQwriteCrazyKong;
+            }
+        }
+        else if (m_cycleType == CYCLE_TYPE_LADYBUG)
+        {
+            m_readCycle[window]  = MREQreadLadybug;
+            m_writeCycle[window] = MREQwrite;
+        }
+        else
+        {
+            m_readCycle[window]  = clkSync ? MREQreadClk  : MREQread;
+            m_writeCycle[window] = clkSync ? MREQwriteClk : MREQwrite;
+        }
+    }
 };
 
 //
@@ -510,6 +565,9 @@ CZ80ACpu::memoryRead(
     register UINT8 r1;
     register UINT8 r2;
 
+    BUS_STATS_INC(reads);
+    BUS_STATS_INC_IF(IS_IO_SPACE(address), ioCycles);
+
     // Before processing anything, perform any address remapping.
     if (m_addressRemapCallback)
     {
@@ -528,7 +586,8 @@ CZ80ACpu::memoryRead(
     // Set the databus to input.
     m_busD.pinMode(INPUT);
 
-    // Critical timing section
+    // Critical timing section, the caller's interrupt state is restored after.
+    UINT8 sreg = SREG;
     noInterrupts();
 
     // Check for video RAM access that requires synchronization
@@ -536,6 +595,8 @@ CZ80ACpu::memoryRead(
 
     if (IS_WAIT_SPACE(address))
     {
+        UINT8 startTicks = BUS_STATS_TICKS();
+
         *g_portOutB = ~(s_B3_BIT_OUT_MREQ);
 
         // Wait for wait to become active (leaving HBLANK)
@@ -545,45 +606,16 @@ CZ80ACpu::memoryRead(
         WAIT_FOR_WAIT_HI(r1,r2);
 
         *g_portOutB = ~(0);
-    }
-    else if (m_cycleType == CYCLE_TYPE_DEFAULT)
-    {
-        // Wait for the clock edge
-        WAIT_FOR_CLK_RISING_EDGE(r1,r2);
-    }
 
-    // Select the address space based on the supplied address
-    if (IS_IO_SPACE(address))
-    {
-        error = IORQread(data);
+        // The sync loops are too tight to count polls in, only the time is kept.
+        BUS_STATS_CYCLE(0, (UINT8) (BUS_STATS_TICKS() - startTicks));
+        BUS_STATS_INC(waitCycles);
     }
-    else
-    {
-        if (m_cycleType == CYCLE_TYPE_PUCKMAN)
-        {
-            error = MREQreadPuckman(data);
-        }
-        else if (m_cycleType == CYCLE_TYPE_CRAZYKONG)
-        {
-            if (IS_SYNC_SPACE(address))
-            {
-                // Wait for the clock edge
-                WAIT_FOR_CLK_FALLING_EDGE(r1,r2);
-            }
 
-            error = MREQreadCrazyKong(data);
-        }
-        else if (m_cycleType == CYCLE_TYPE_LADYBUG)
-        {
-            error = MREQreadLadybug(data);
-        }
-        else
-        {
-            error = MREQread(data);
-        }
-    }
+    // The cycle for the address space was resolved at construction.
+    error = m_readCycle[ADDRESS_WINDOW(address)](data);
 
-    interrupts();
+    SREG = sreg;
 
     // Before return perform any data remapping.
     if (SUCCESS(error))
@@ -610,6 +642,9 @@ CZ80ACpu::memoryWrite(
     register UINT8 r1;
     register UINT8 r2;
 
+    BUS_STATS_INC(writes);
+    BUS_STATS_INC_IF(IS_IO_SPACE(address), ioCycles);
+
     // Before processing anything, perform any address remapping.
     if (m_addressRemapCallback)
     {
@@ -640,7 +675,8 @@ CZ80ACpu::memoryWrite(
     m_busD.pinMode(OUTPUT);
     m_busD.digitalWrite(data);
 
-    // Critical timing section
+    // Critical timing section, the caller's interrupt state is restored after.
+    UINT8 sreg = SREG;
     noInterrupts();
 
     // Check for video RAM access that requires synchronization
@@ -648,6 +684,8 @@ CZ80ACpu::memoryWrite(
 
     if (IS_WAIT_SPACE(address))
     {
+        UINT8 startTicks = BUS_STATS_TICKS();
+
         *g_portOutB = ~(s_B3_BIT_OUT_MREQ);
 
         // Wait for wait to become active (leaving HBLANK)
@@ -657,41 +695,16 @@ CZ80ACpu::memoryWrite(
         WAIT_FOR_WAIT_HI(r1,r2);
 
         *g_portOutB = ~(0);
-    }
-    else if (m_cycleType == CYCLE_TYPE_DEFAULT)
-    {
-        // Wait for the clock edge
-        WAIT_FOR_CLK_RISING_EDGE(r1,r2);
-    }
 
-    // Select the address space based on the supplied address
-    if (IS_IO_SPACE(address))
-    {
-        error = IORQwrite(data);
+        // The sync loops are too tight to count polls in, only the time is kept.
+        BUS_STATS_CYCLE(0, (UINT8) (BUS_STATS_TICKS() - startTicks));
+        BUS_STATS_INC(waitCycles);
     }
-    else
-    {
-        if (m_cycleType == CYCLE_TYPE_PUCKMAN)
-        {
-            error = MREQwritePuckman(data);
-        }
-        else if (m_cycleType == CYCLE_TYPE_CRAZYKONG)
-        {
-            if (IS_SYNC_SPACE(address))
-            {
-                // Wait for the clock edge
-                WAIT_FOR_CLK_FALLING_EDGE(r1,r2);
-            }
 
-            error = MREQwriteCrazyKong(data);
-        }
-        else
-        {
-            error = MREQwrite(data);
-        }
-    }
+    // The cycle for the address space was resolved at construction.
+    error = m_writeCycle[ADDRESS_WINDOW(address)](&data);
 
-    interrupts();
+    SREG = sreg;
 
     return error;
 }
@@ -745,6 +758,8 @@ CZ80ACpu::acknowledgeInterrupt(
 {
     PERROR error = errorSuccess;
 
+    BUS_STATS_INC(interruptAcks);
+
     // Enable the address bus, unused for interrupt acknowledge
     m_busA.pinMode(OUTPUT);
     m_busA.digitalWrite((UINT16) 0xFFFF);
@@ -899,6 +914,36 @@ Exit:
 }
 
 
+PERROR
+CZ80ACpu::MREQreadClk(
+    UINT16 *data
+)
+{
+    register UINT8 r1;
+    register UINT8 r2;
+
+    // Wait for the clock edge
+    WAIT_FOR_CLK_RISING_EDGE(r1,r2);
+
+    return MREQread(data);
+}
+
+
+PERROR
+CZ80ACpu::MREQwriteClk(
+    UINT16 *data
+)
+{
+    register UINT8 r1;
+    register UINT8 r2;
+
+    // Wait for the clock edge
+    WAIT_FOR_CLK_RISING_EDGE(r1,r2);
+
+    return MREQwrite(data);
+}
+
+
 PERROR
 CZ80ACpu::MREQreadPuckman(
     UINT16 *data
@@ -1099,6 +1144,36 @@ Exit:
 }
 
 
+PERROR
+CZ80ACpu::MREQreadCrazyKongSync(
+    UINT16 *data
+)
+{
+    register UINT8 r1;
+    register UINT8 r2;
+
+    // Wait for the clock edge
+    WAIT_FOR_CLK_FALLING_EDGE(r1,r2);
+
+    return MREQreadCrazyKong(data);
+}
+
+
+PERROR
+CZ80ACpu::MREQwriteCrazyKongSync(
+    UINT16 *data
+)
+{
+    register UINT8 r1;
+    register UINT8 r2;
+
+    // Wait for the clock edge
+    WAIT_FOR_CLK_FALLING_EDGE(r1,r2);
+
+    return MREQwriteCrazyKong(data);
+}
+
+
 PERROR
 CZ80ACpu::MREQreadLadybug(
     UINT16 *data
@@ -1254,3 +1329,33 @@ Exit:
     return error;
 }
 
+
+PERROR
+CZ80ACpu::IORQreadClk(
+    UINT16 *data
+)
+{
+    register UINT8 r1;
+    register UINT8 r2;
+
+    // Wait for the clock edge
+    WAIT_FOR_CLK_RISING_EDGE(r1,r2);
+
+    return IORQread(data);
+}
+
+
+PERROR
+CZ80ACpu::IORQwriteClk(
+    UINT16 *data
+)
+{
+    register UINT8 r1;
+    register UINT8 r2;
+
+    // Wait for the clock edge
+    WAIT_FOR_CLK_RISING_EDGE(r1,r2);
+
+    return IORQwrite(data);
+}
+
@@ -106,6 +106,7 @@ class CZ80ACpu : public ICpu
         // 0x000000 -> 0x00FFFF - Memory Mapped Data
         // 0x010000 -> 0x01FFFF - Input/Output Ports
         // 0x1xxxxx             - WAIT pre-synchronized space
+        // 0x2xxxxx             - CLK synchronized space (Crazy Kong only)
 
         virtual PERROR memoryRead(
             UINT32 address,
@@ -137,31 +138,57 @@ class CZ80ACpu : public ICpu
 
     private:
 
+        //
+        // The bus cycle implementations. These are static because they only
+        // operate on the port registers and this allows a plain function
+        // pointer (2 bytes) to be used in the dispatch tables below.
+        //
+        typedef PERROR (*CycleCallback)(UINT16 *data);
+
         //
         // The original implementation of the Z80 bus
         // cycle that's used for most games.
         //
+        static
         PERROR
         MREQread(
             UINT16 *data
         );
 
+        static
         PERROR
         MREQwrite(
             UINT16 *data
         );
 
+        //
+        // As above but synchronized to the clock rising edge first.
+        //
+        static
+        PERROR
+        MREQreadClk(
+            UINT16 *data
+        );
+
+        static
+        PERROR
+        MREQwriteClk(
+            UINT16 *data
+        );
+
         //
         // An implementation that has a longer wait prior
         // to the initial detection of WAIT and immediate
         // data read after WAIT is cleared.
         // This handles the Puckman Sync Bus Controller
         //
+        static
         PERROR
         MREQreadPuckman(
             UINT16 *data
         );
 
+        static
         PERROR
         MREQwritePuckman(
             UINT16 *data
@@ -171,35 +198,71 @@ class CZ80ACpu : public ICpu
         // Same as Puckman but with one extra wait state for
         // Crazy Kong RAM at 0x9000.
         //
+        static
         PERROR
         MREQreadCrazyKong(
             UINT16 *data
         );
 
+        static
         PERROR
         MREQwriteCrazyKong(
             UINT16 *data
         );
 
+        //
+        // As above but synchronized to the clock falling edge first
+        // for the Crazy Kong sync space.
+        //
+        static
+        PERROR
+        MREQreadCrazyKongSync(
+            UINT16 *data
+        );
+
+        static
+        PERROR
+        MREQwriteCrazyKongSync(
+            UINT16 *data
+        );
+
         // An implementation that has a longer wait prior
         // to the initial detection of WAIT.
         // This handles reading the Ladybug video and color ram
         //
+        static
         PERROR
         MREQreadLadybug(
             UINT16 *data
         );
 
+        static
         PERROR
         IORQread(
             UINT16 *data
         );
 
+        static
         PERROR
         IORQwrite(
             UINT16 *data
         );
 
+        //
+        // As above but synchronized to the clock rising edge first.
+        //
+        static
+        PERROR
+        IORQreadClk(
+            UINT16 *data
+        );
+
+        static
+        PERROR
+        IORQwriteClk(
+            UINT16 *data
+        );
+
     private:
 
         CBus          m_busA;
@@ -221,6 +284,13 @@ class CZ80ACpu : public ICpu
         void                 *m_dataRemapCallbackContext;
         CycleType             m_cycleType;
 
+        //
+        // The bus cycle to use for each address space window, resolved once at
+        // construction from the cycle type. Indexed by the IO, WAIT & SYNC address bits.
+        //
+        CycleCallback         m_readCycle[8];
+        CycleCallback         m_writeCycle[8];
+
 };
 
 #endif
@@ -307,6 +307,8 @@ CZ80Cpu::selectAddressSpace(
     if ( (address >= (UINT32) 0x10000) &&
          (address <= (UINT32) 0x1FFFF) )
     {
+        BUS_STATS_INC(ioCycles);
+
         m_pin_IORQ.digitalWriteLOW();
         m_pin_MREQ.digitalWriteHIGH();
     }
@@ -325,6 +327,9 @@ CZ80Cpu::memoryRead(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
+
+    BUS_STATS_INC(reads);
 
     // Before processing anything, perform any address remapping.
     if (m_addressRemapCallback)
@@ -357,6 +362,9 @@ CZ80Cpu::memoryRead(
     // Poll WAIT for cycle completion
     {
         int waitValue;
+        int i;
+        UINT16 polls = 0;
+        UINT8 startTicks = BUS_STATS_TICKS();
 
         // Check for the Money Money V-RAM access that requires synchronization
         // with HBLANK using the WAIT input.
@@ -364,7 +372,7 @@ CZ80Cpu::memoryRead(
         if (address & 0x100000)
         {
             // Wait for wait to become active (leaving HBLANK)
-            for (int i = 0 ; i < 4096 ; i++)
+            for (i = 0 ; i < 4096 ; i++)
             {
                 waitValue = m_pin_WAIT.digitalRead();
 
@@ -373,10 +381,12 @@ CZ80Cpu::memoryRead(
                     break;
                 }
             }
+            polls += i;
+            BUS_STATS_INC_IF(waitValue != LOW, timeouts);
             CHECK_LITERAL_VALUE_EXIT(error, s__WAIT_i, waitValue, LOW);
 
             // Wait for wait to become inactive (start of HBLANK)
-            for (int i = 0 ; i < 4096 ; i++)
+            for (i = 0 ; i < 4096 ; i++)
             {
                 waitValue = m_pin_WAIT.digitalRead();
 
@@ -385,11 +395,13 @@ CZ80Cpu::memoryRead(
                     break;
                 }
             }
+            polls += i;
+            BUS_STATS_INC_IF(waitValue != HIGH, timeouts);
             CHECK_LITERAL_VALUE_EXIT(error, s__WAIT_i, waitValue, HIGH);
         }
 
         // Perform a usual cycle.
-        for (int i = 0 ; i < 64 ; i++)
+        for (i = 0 ; i < 64 ; i++)
         {
             waitValue = m_pin_WAIT.digitalRead();
 
@@ -401,7 +413,11 @@ CZ80Cpu::memoryRead(
                 break;
             }
         }
+        polls += i;
+        BUS_STATS_INC_IF(waitValue != HIGH, timeouts);
         CHECK_LITERAL_VALUE_EXIT(error, s__WAIT_i, waitValue, HIGH);
+
+        BUS_STATS_CYCLE(polls, (UINT8) (BUS_STATS_TICKS() - startTicks));
     }
 
     // Money Money V-RAM access that prefers the address to be
@@ -422,9 +438,10 @@ CZ80Cpu::memoryRead(
 
 Exit:
 
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
     return error;
 }
@@ -438,6 +455,9 @@ CZ80Cpu::memoryWrite(
 {
     PERROR error = errorSuccess;
     bool interruptsDisabled = false;
+    UINT8 sreg = SREG;
+
+    BUS_STATS_INC(writes);
 
     // Before processing anything, perform any address remapping.
     if (m_addressRemapCallback)
@@ -482,6 +502,9 @@ CZ80Cpu::memoryWrite(
     // Poll WAIT for cycle completion
     {
         int waitValue;
+        int i;
+        UINT16 polls = 0;
+        UINT8 startTicks = BUS_STATS_TICKS();
 
         // Check for the Money Money V-RAM access that requires synchronization
         // with HBLANK using the WAIT input.
@@ -489,7 +512,7 @@ CZ80Cpu::memoryWrite(
         if (address & 0x100000)
         {
             // Wait for wait to become active (leaving HBLANK)
-            for (int i = 0 ; i < 4096 ; i++)
+            for (i = 0 ; i < 4096 ; i++)
             {
                 waitValue = m_pin_WAIT.digitalRead();
 
@@ -498,10 +521,12 @@ CZ80Cpu::memoryWrite(
                     break;
                 }
             }
+            polls += i;
+            BUS_STATS_INC_IF(waitValue != LOW, timeouts);
             CHECK_LITERAL_VALUE_EXIT(error, s__WAIT_i, waitValue, LOW);
 
             // Wait for wait to become inactive (start of HBLANK)
-            for (int i = 0 ; i < 4096 ; i++)
+            for (i = 0 ; i < 4096 ; i++)
             {
                 waitValue = m_pin_WAIT.digitalRead();
 
@@ -510,10 +535,12 @@ CZ80Cpu::memoryWrite(
                     break;
                 }
             }
+            polls += i;
+            BUS_STATS_INC_IF(waitValue != HIGH, timeouts);
             CHECK_LITERAL_VALUE_EXIT(error, s__WAIT_i, waitValue, HIGH);
         }
 
-        for (int i = 0 ; i < 64 ; i++)
+        for (i = 0 ; i < 64 ; i++)
         {
             waitValue = m_pin_WAIT.digitalRead();
 
@@ -525,7 +552,11 @@ CZ80Cpu::memoryWrite(
                 break;
             }
         }
+        polls += i;
+        BUS_STATS_INC_IF(waitValue != HIGH, timeouts);
         CHECK_LITERAL_VALUE_EXIT(error, s__WAIT_i, waitValue, HIGH);
+
+        BUS_STATS_CYCLE(polls, (UINT8) (BUS_STATS_TICKS() - startTicks));
     }
 
     // Money Money V-RAM access that prefers the address to be
@@ -536,9 +567,10 @@ CZ80Cpu::memoryWrite(
 
 Exit:
 
+    // Restore rather than enable so a caller can keep interrupts masked.
     if (interruptsDisabled)
     {
-        interrupts();
+        SREG = sreg;
     }
 
     return error;
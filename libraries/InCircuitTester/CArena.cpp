@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CArena.h"
+#include <stddef.h>
+
+//
+// Allocations are rounded up to keep every object suitably aligned for any
+// type. On the AVR this is 1 and so costs nothing, but the bench build on a
+// PC constructs the same objects from the arena.
+//
+static const size_t s_alignment = alignof(max_align_t);
+
+alignas(max_align_t) static UINT8 s_arena[CArena::c_size];
+static UINT16 s_used;
+static UINT16 s_highWater;
+
+
+void *
+CArena::alloc(
+    size_t size
+)
+{
+    void *p;
+
+    size = (size + (s_alignment - 1)) & ~(s_alignment - 1);
+
+    if (size > (size_t) (c_size - s_used))
+    {
+        return malloc(size);
+    }
+
+    p = &s_arena[s_used];
+
+    s_used += size;
+
+    if (s_used > s_highWater)
+    {
+        s_highWater = s_used;
+    }
+
+    return p;
+}
+
+
+void
+CArena::release(
+    void *p
+)
+{
+    if ((p < (void *) &s_arena[0]) || (p >= (void *) &s_arena[c_size]))
+    {
+        free(p);
+    }
+}
+
+
+void
+CArena::reset(
+)
+{
+    s_used = 0;
+    s_highWater = 0;
+}
+
+
+UINT16
+CArena::used(
+)
+{
+    return s_used;
+}
+
+
+UINT16
+CArena::highWater(
+)
+{
+    return s_highWater;
+}
+
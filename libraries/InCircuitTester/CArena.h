@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CArena_h
+#define CArena_h
+
+#include "Arduino.h"
+#include "Types.h"
+
+//
+// A bump allocator for the objects that make up a game (the game, CPU,
+// buses & helper chips). This is a static class.
+//
+// Everything a game allocates is released together when the game is switched,
+// so rather than each object being returned to the heap one at a time (and
+// fragmenting it) the arena is simply reset. Allocation is a pointer bump.
+//
+// If the arena is full the allocation falls back to the heap so a game that
+// doesn't fit still runs, it just doesn't get the benefit.
+//
+class CArena
+{
+    public:
+
+        //
+        // The size of the arena in bytes.
+        //
+        static const UINT16 c_size = 1024;
+
+        static void *alloc(
+            size_t size
+        );
+
+        //
+        // Only heap fallback allocations are freed, arena allocations are
+        // reclaimed by reset.
+        //
+        static void release(
+            void *p
+        );
+
+        //
+        // Reclaim the whole arena. Only to be used when all the objects allocated
+        // from it have been deleted.
+        //
+        static void reset(
+        );
+
+        //
+        // The number of bytes in use and the most used since the last reset.
+        //
+        static UINT16 used(
+        );
+
+        static UINT16 highWater(
+        );
+};
+
+//
+// Base class for objects that are allocated from the arena with "new".
+//
+class CArenaObject
+{
+    public:
+
+        static void *operator new(
+            size_t size
+        )
+        {
+            return CArena::alloc(size);
+        }
+
+        static void operator delete(
+            void *p
+        )
+        {
+            CArena::release(p);
+        }
+};
+
+#endif
+
@@ -0,0 +1,130 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CAuxSignal.h"
+#include "PinMap.h"
+
+//
+// The levels are taken from this many samples, a few periods of the
+// slowest signal of interest.
+//
+static const UINT16 s_levelSamples = 512;
+
+//
+// The rising crossings are counted for this long.
+//
+static const UINT32 s_gateTimeInUs = 200000;
+
+
+void
+CAuxSignal::levels(
+    UINT8 auxPin,
+    int   *minimum,
+    int   *maximum
+)
+{
+    UINT8 pin = g_pinMap8Aux[auxPin];
+
+    *minimum = 1023;
+    *maximum = 0;
+
+    ::pinMode(pin, INPUT);
+
+    for (UINT16 sample = 0 ; sample < s_levelSamples ; sample++)
+    {
+        int value = analogRead(pin);
+
+        *minimum = (value < *minimum) ? value : *minimum;
+        *maximum = (value > *maximum) ? value : *maximum;
+    }
+}
+
+
+//
+// The crossings use thresholds at 1/3 & 2/3 of the swing for hysteresis.
+// The frequency comes from the time between the first & last crossing
+// rather than the gate time so there's no +/- 1 count error.
+//
+void
+CAuxSignal::frequency(
+    UINT8  auxPin,
+    UINT32 *frequencyInHz
+)
+{
+    UINT8 pin = g_pinMap8Aux[auxPin];
+    int minimum;
+    int maximum;
+    int thresholdHi;
+    int thresholdLo;
+    bool high;
+    UINT32 crossings = 0;
+    UINT32 firstCrossing = 0;
+    UINT32 lastCrossing = 0;
+    UINT32 startTime;
+
+    *frequencyInHz = 0;
+
+    levels(auxPin, &minimum, &maximum);
+
+    if ((maximum - minimum) < c_minimumSwing)
+    {
+        return;
+    }
+
+    thresholdHi = minimum + (((maximum - minimum) * 2) / 3);
+    thresholdLo = minimum + (((maximum - minimum) * 1) / 3);
+    high = (analogRead(pin) > thresholdHi);
+
+    startTime = micros();
+
+    while ((micros() - startTime) < s_gateTimeInUs)
+    {
+        int value = analogRead(pin);
+
+        if (!high && (value > thresholdHi))
+        {
+            high = true;
+            lastCrossing = micros();
+
+            if (crossings == 0)
+            {
+                firstCrossing = lastCrossing;
+            }
+
+            crossings++;
+        }
+        else if (high && (value < thresholdLo))
+        {
+            high = false;
+        }
+    }
+
+    if ((crossings >= 2) && (lastCrossing != firstCrossing))
+    {
+        UINT32 time = lastCrossing - firstCrossing;
+
+        *frequencyInHz = (((crossings - 1) * 1000000UL) + (time / 2)) / time;
+    }
+}
+
@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CAuxSignal_h
+#define CAuxSignal_h
+
+#include "Arduino.h"
+#include "Types.h"
+
+//
+// Measurement of an analog signal probed on a J14 AUX pin, e.g. the output
+// of a sound generator. This is a static class.
+//
+// The AUX pins are ADC8 to ADC15 but not timer inputs, so the frequency is
+// measured by sampling the signal and timing the crossings of the middle of
+// its swing. An ADC conversion takes ~112us so this is good for a few kHz.
+//
+class CAuxSignal
+{
+    public:
+
+        //
+        // A swing of fewer ADC steps than this is taken to be no signal.
+        //
+        static const int c_minimumSwing = 16;
+
+        //
+        // The lowest & highest ADC readings over a fixed number of samples.
+        //
+        static void levels(
+            UINT8 auxPin,
+            int   *minimum,
+            int   *maximum
+        );
+
+        //
+        // The frequency of the signal, or 0 if the swing is too small to
+        // be a signal (or there are too few crossings in the gate time).
+        //
+        static void frequency(
+            UINT8  auxPin,
+            UINT32 *frequencyInHz
+        );
+
+};
+
+#endif
+
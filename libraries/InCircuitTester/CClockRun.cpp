@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CClockRun.h"
+#include "CFastPin.h"
+#include "CScheduler.h"
+#include "PinMap.h"
+
+
+CClockRun::CClockRun(
+    IClockMasterCpu *cpu
+) : m_cpu(cpu)
+{
+};
+
+
+PERROR
+CClockRun::runToAuxPin(
+    UINT8   pin,
+    int     level,
+    UINT32  clockLimit,
+    UINT32 *clocks
+)
+{
+    PERROR error = errorTimeout;
+    CONNECTION connection = {pin, "AUX"};
+    CFastPin pinAux(g_pinMap8Aux, &connection);
+    UINT32 clock = 0;
+
+    pinAux.pinMode(INPUT);
+
+    // The condition may already be met before any clocks are run.
+    if (pinAux.digitalRead() == level)
+    {
+        error = errorSuccess;
+    }
+
+    while (FAILED(error) && (clock < clockLimit))
+    {
+        UINT32 end = clock + c_burst;
+
+        if (end > clockLimit)
+        {
+            end = clockLimit;
+        }
+
+        noInterrupts();
+
+        for ( ; clock < end ; clock++)
+        {
+            m_cpu->clockPulse();
+
+            if (pinAux.digitalRead() == level)
+            {
+                clock++;
+                error = errorSuccess;
+                break;
+            }
+        }
+
+        interrupts();
+
+        if (FAILED(error))
+        {
+            YIELD_CHECK_ABORT_BREAK(error);
+        }
+    }
+
+    *clocks = clock;
+
+    return error;
+}
+
+
+PERROR
+CClockRun::runToStatus(
+    UINT32  address,
+    UINT16  mask,
+    UINT16  value,
+    UINT32  burst,
+    UINT32  clockLimit,
+    UINT32 *clocks
+)
+{
+    PERROR error = errorSuccess;
+    UINT32 startCount = m_cpu->clockCount();
+    UINT16 recData;
+
+    for ( ; ; )
+    {
+        CHECK_CPU_READ_EXIT(error, m_cpu, address, &recData);
+
+        if ((recData & mask) == value)
+        {
+            break;
+        }
+
+        // The status reads are counted against the limit too.
+        {
+            UINT32 clock = m_cpu->clockCount() - startCount;
+
+            if (clock >= clockLimit)
+            {
+                error = errorTimeout;
+                break;
+            }
+
+            if (burst > (clockLimit - clock))
+            {
+                burst = clockLimit - clock;
+            }
+        }
+
+        m_cpu->clockPulses(burst);
+
+        YIELD_CHECK_ABORT_BREAK(error);
+    }
+
+Exit:
+    *clocks = m_cpu->clockCount() - startCount;
+
+    return error;
+}
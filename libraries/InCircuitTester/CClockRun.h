@@ -0,0 +1,92 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CClockRun_h
+#define CClockRun_h
+
+#include "Arduino.h"
+#include "Types.h"
+#include "IClockMasterCpu.h"
+
+//
+// Runs the master clock of a clock master CPU until a condition on the
+// board is met and reports how many master clocks it took. Because the
+// tester owns the clock the count is repeatable run to run, which makes
+// it useful for comparing the completion time of a state machine (e.g.
+// a vector generator or math box) against a known good board.
+//
+// If the condition isn't met within the clock limit errorTimeout is
+// returned, with the clocks still set to the number actually run.
+//
+class CClockRun
+{
+    public:
+
+        CClockRun(
+            IClockMasterCpu *cpu
+        );
+
+        //
+        // Run until J14 AUX pin 'pin' reads 'level'. The pin is sampled
+        // after every clock so the count is that of the exact clock that
+        // the pin changed on.
+        //
+        PERROR
+        runToAuxPin(
+            UINT8   pin,
+            int     level,
+            UINT32  clockLimit,
+            UINT32 *clocks
+        );
+
+        //
+        // Run until a status read of 'address' masked with 'mask' equals
+        // 'value'. The status is read after every 'burst' clocks, or back
+        // to back with a burst of 0. The count includes the clocks of the
+        // status reads themselves and so is exact for the clocks run, but
+        // the condition may have been met at any point since the last read.
+        //
+        PERROR
+        runToStatus(
+            UINT32  address,
+            UINT16  mask,
+            UINT16  value,
+            UINT32  burst,
+            UINT32  clockLimit,
+            UINT32 *clocks
+        );
+
+    private:
+
+        //
+        // Number of clocks run with interrupts disabled before the
+        // scheduler is given a chance to run.
+        //
+        static const UINT16 c_burst = 512;
+
+        IClockMasterCpu *m_cpu;
+
+};
+
+#endif
@@ -0,0 +1,205 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CFailureLog.h"
+#include <avr/eeprom.h>
+
+//
+// The log fills the Mega's 4KB EEPROM.
+//
+static const UINT16 s_numSlots = (E2END + 1) / sizeof(CFailureLog::RECORD);
+
+#define SLOT_ADDRESS(slot) ((CFailureLog::RECORD *) ((slot) * sizeof(CFailureLog::RECORD)))
+
+UINT16 CFailureLog::s_head;
+UINT16 CFailureLog::s_count;
+UINT16 CFailureLog::s_sequence;
+
+
+//
+// Records are written in sequence order round the ring and a clear only
+// empties the slots, so the newest record is the one that the next slot
+// doesn't follow on from, either because it's empty or it's the oldest.
+//
+void
+CFailureLog::begin(
+)
+{
+    UINT16 newest;
+
+    s_head     = 0;
+    s_count    = 0;
+    s_sequence = 0;
+
+    for (newest = 0 ; newest < s_numSlots ; newest++)
+    {
+        UINT16 sequence = readSequence(newest);
+
+        if ((sequence != c_empty) &&
+            (readSequence((newest + 1) % s_numSlots) != nextSequence(sequence)))
+        {
+            break;
+        }
+    }
+
+    if (newest == s_numSlots)
+    {
+        return;
+    }
+
+    s_head     = (newest + 1) % s_numSlots;
+    s_sequence = nextSequence(readSequence(newest));
+
+    //
+    // Count back from the newest record until a slot is empty or doesn't
+    // lead on to the one after it.
+    //
+    for (s_count = 1 ; s_count < s_numSlots ; s_count++)
+    {
+        UINT16 slot     = (newest + s_numSlots - s_count) % s_numSlots;
+        UINT16 sequence = readSequence(slot);
+
+        if ((sequence == c_empty) ||
+            (readSequence((slot + 1) % s_numSlots) != nextSequence(sequence)))
+        {
+            break;
+        }
+    }
+}
+
+
+void
+CFailureLog::add(
+    UINT8  gameId,
+    UINT8  selection,
+    PERROR error
+)
+{
+    RECORD record;
+
+    record.sequence  = s_sequence;
+    record.gameId    = gameId;
+    record.selection = selection;
+    record.timeInS   = millis() / 1000;
+    record.code      = error->code;
+    record.address   = errorDetail.address;
+    record.expected  = errorDetail.expected;
+    record.received  = errorDetail.received;
+    record.check     = checksum(&record);
+
+    // Only the bytes that have changed are written.
+    eeprom_update_block(&record, SLOT_ADDRESS(s_head), sizeof(record));
+
+    s_head     = (s_head + 1) % s_numSlots;
+    s_sequence = nextSequence(s_sequence);
+
+    if (s_count < s_numSlots)
+    {
+        s_count++;
+    }
+}
+
+
+UINT16
+CFailureLog::count(
+)
+{
+    return s_count;
+}
+
+
+bool
+CFailureLog::get(
+    UINT16   index,
+    PRECORD  record
+)
+{
+    UINT16 slot = (s_head + s_numSlots - 1 - index) % s_numSlots;
+
+    if (index >= s_count)
+    {
+        return false;
+    }
+
+    eeprom_read_block(record, SLOT_ADDRESS(slot), sizeof(*record));
+
+    return (record->check == checksum(record));
+}
+
+
+//
+// Only the sequence numbers are erased to limit the wear. The head & sequence
+// carry on from where they were so the writes keep moving round the ring
+// rather than starting again at slot 0 after every clear.
+//
+void
+CFailureLog::clear(
+)
+{
+    for (UINT16 slot = 0 ; slot < s_numSlots ; slot++)
+    {
+        eeprom_update_word(&SLOT_ADDRESS(slot)->sequence, c_empty);
+    }
+
+    s_count = 0;
+}
+
+
+UINT16
+CFailureLog::nextSequence(
+    UINT16 sequence
+)
+{
+    sequence++;
+
+    return (sequence == c_empty) ? 0 : sequence;
+}
+
+
+UINT8
+CFailureLog::checksum(
+    const RECORD *record
+)
+{
+    const UINT8 *data = (const UINT8 *) record;
+    UINT8 sum = 0;
+
+    for (UINT8 i = 0 ; i < sizeof(*record) ; i++)
+    {
+        sum += data[i];
+    }
+
+    // Exclude the check byte itself.
+    return ~(sum - (UINT8) record->check);
+}
+
+
+UINT16
+CFailureLog::readSequence(
+    UINT16 slot
+)
+{
+    return eeprom_read_word(&SLOT_ADDRESS(slot)->sequence);
+}
+
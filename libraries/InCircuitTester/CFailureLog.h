@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CFailureLog_h
+#define CFailureLog_h
+
+#include "Arduino.h"
+#include "Types.h"
+#include "Error.h"
+
+//
+// A ring log of failures kept in EEPROM so that the results of an unattended
+// soak test survive a power cycle. This is a static class.
+//
+// Records are written to the next slot round the ring so every slot takes the
+// same number of writes (wear levelling). Each record has a sequence number so
+// that the newest record can be found again at power up without keeping a head
+// pointer in a single, heavily written, EEPROM location.
+//
+class CFailureLog
+{
+    public:
+
+        //
+        // The selection field holds the selector in the top bits & the index
+        // of the selection within that selector in the bottom bits.
+        //
+        static const UINT8 c_selectorGame     = 0x00;
+        static const UINT8 c_selectorGeneric  = 0x40;
+        static const UINT8 c_selectorSoakTest = 0x80;
+        static const UINT8 c_selectorMask     = 0xC0;
+        static const UINT8 c_selectionMask    = 0x3F;
+
+        //
+        // A single 16 byte failure record.
+        //
+        typedef struct _RECORD {
+
+            UINT16 sequence;           // Write sequence number, c_empty if the slot is unused.
+            UINT8  gameId;             // Index of the game in the game selector.
+            UINT8  selection;          // Selector & selection index.
+            UINT32 timeInS      : 24;  // Seconds since power up.
+            UINT32 code         :  8;  // Error code.
+            UINT32 address      : 24;  // Packed error detail.
+            UINT32 check        :  8;  // Checksum of the record.
+            UINT16 expected;
+            UINT16 received;
+
+        } RECORD, *PRECORD;
+
+        //
+        // Find the newest record in the log. Must be called before any other use.
+        //
+        static void begin(
+        );
+
+        //
+        // Add a record for the supplied error using the current error detail.
+        //
+        static void add(
+            UINT8  gameId,
+            UINT8  selection,
+            PERROR error
+        );
+
+        //
+        // The number of records in the log.
+        //
+        static UINT16 count(
+        );
+
+        //
+        // Read a record where index 0 is the newest.
+        // Returns false if the record is out of range or corrupt.
+        //
+        static bool get(
+            UINT16   index,
+            PRECORD  record
+        );
+
+        //
+        // Empty the log.
+        //
+        static void clear(
+        );
+
+        //
+        // Sequence number of an unused slot (erased EEPROM).
+        //
+        static const UINT16 c_empty = 0xFFFF;
+
+    private:
+
+        static UINT16 nextSequence(
+            UINT16 sequence
+        );
+
+        static UINT8 checksum(
+            const RECORD *record
+        );
+
+        static UINT16 readSequence(
+            UINT16 slot
+        );
+
+        static UINT16 s_head;
+        static UINT16 s_count;
+        static UINT16 s_sequence;
+};
+
+#endif
+
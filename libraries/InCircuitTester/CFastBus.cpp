@@ -23,6 +23,7 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //
 #include "CFastBus.h"
+#include "CArena.h"
 
 
 CFastBus::CFastBus(
@@ -33,11 +34,11 @@ CFastBus::CFastBus(
     m_pinModeSet(false),
     m_currentPinMode(INPUT)
 {
-    m_decodedPinMap            = (UINT8*)malloc(m_dataBusSize * sizeof(*m_decodedPinMap));
-    m_physicalPinMask          = (UINT8*)malloc(m_dataBusSize * sizeof(*m_physicalPinMask));
-    m_physicalPortRegisterIn   = (volatile UINT8**)malloc(m_dataBusSize * sizeof(*m_physicalPortRegisterIn));
-    m_physicalPortRegisterOut  = (volatile UINT8**)malloc(m_dataBusSize * sizeof(*m_physicalPortRegisterOut));
-    m_physicalPortRegisterMode = (volatile UINT8**)malloc(m_dataBusSize * sizeof(*m_physicalPortRegisterMode));
+    m_decodedPinMap            = (UINT8*)CArena::alloc(m_dataBusSize * sizeof(*m_decodedPinMap));
+    m_physicalPinMask          = (UINT8*)CArena::alloc(m_dataBusSize * sizeof(*m_physicalPinMask));
+    m_physicalPortRegisterIn   = (volatile UINT8**)CArena::alloc(m_dataBusSize * sizeof(*m_physicalPortRegisterIn));
+    m_physicalPortRegisterOut  = (volatile UINT8**)CArena::alloc(m_dataBusSize * sizeof(*m_physicalPortRegisterOut));
+    m_physicalPortRegisterMode = (volatile UINT8**)CArena::alloc(m_dataBusSize * sizeof(*m_physicalPortRegisterMode));
 
     for (UINT8 i = 0 ; i < m_dataBusSize ; i++)
     {
@@ -56,11 +57,11 @@ CFastBus::CFastBus(
 CFastBus::~CFastBus(
 )
 {
-    free(m_decodedPinMap);
-    free(m_physicalPinMask);
-    free(m_physicalPortRegisterIn);
-    free(m_physicalPortRegisterOut);
-    free(m_physicalPortRegisterMode);
+    CArena::release(m_decodedPinMap);
+    CArena::release(m_physicalPinMask);
+    CArena::release(m_physicalPortRegisterIn);
+    CArena::release(m_physicalPortRegisterOut);
+    CArena::release(m_physicalPortRegisterMode);
 };
 
 
@@ -49,3 +49,39 @@ CFastPin::pinMode(
     ::pinMode(m_decodedPinMap, mode);
 };
 
+
+//
+// The master clock pin (J14 AUX 8, PK7) isn't an output compare pin of any
+// of the timers and so the pulse train can't be handed off to the hardware.
+// This is the fastest software version - the loop is unrolled by 8 so that
+// the loop overhead is only paid once every 8 pulses. The pulse period is
+// 2 cycles high & the low includes the loop on every 8th pulse.
+//
+void
+CFastPin::digitalPulses(
+    UINT32 count
+)
+{
+    volatile UINT8 *port = m_physicalPortRegisterOut;
+    UINT8 lo = *port & m_physicalPinMaskInverted;
+    UINT8 hi = lo | m_physicalPinMask;
+    UINT32 blocks = count >> 3;
+    UINT8 remainder = (UINT8) (count & 7);
+
+    while (blocks-- != 0)
+    {
+        *port = hi; *port = lo;
+        *port = hi; *port = lo;
+        *port = hi; *port = lo;
+        *port = hi; *port = lo;
+        *port = hi; *port = lo;
+        *port = hi; *port = lo;
+        *port = hi; *port = lo;
+        *port = hi; *port = lo;
+    }
+
+    while (remainder-- != 0)
+    {
+        *port = hi; *port = lo;
+    }
+};
@@ -100,6 +100,17 @@ class CFastPin
             *(m_physicalPortRegisterOut) = rawBit;
         };
 
+        //
+        // Drive a burst of 'count' high-low pulses on the pin. The port
+        // values are worked out once up front so the burst is a straight
+        // run of port stores and so nothing else may change the port
+        // whilst it's running.
+        //
+        void
+        digitalPulses(
+            UINT32 count
+        );
+
         inline
         int
         digitalRead(
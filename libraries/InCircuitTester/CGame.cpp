@@ -26,6 +26,9 @@
 #include "CRomCheck.h"
 #include "CRamCheck.h"
 #include "CIoCheck.h"
+#include "CScopeLoop.h"
+#include "CScheduler.h"
+#include "CRegion.h"
 #include <DFR_Key.h>
 
 #include <avr/pgmspace.h>
@@ -80,24 +83,6 @@ CGame::CGame(
 CGame::~CGame(
 )
 {
-    free( m_romRegion );
-
-    if (m_romData2n != 0)
-    {
-        free( m_romData2n );
-    }
-
-    free( m_ramRegion );
-
-    if (m_ramRegionByteOnly != m_ramRegion)
-    {
-        free( m_ramRegionByteOnly );
-    }
-
-    free( m_ramRegionWriteOnly );
-    free( m_inputRegion );
-    free( m_outputRegion );
-    free( m_customFunction );
 }
 
 
@@ -132,7 +117,8 @@ CGame::romCheckAll(
 
     CRomCheck romCheck( m_cpu,
                         m_romRegion,
-                        (void *) this );
+                        (void *) this,
+                        (m_romData2n != NULL) );
 
     error = romCheck.check();
 
@@ -147,14 +133,16 @@ CGame::ramCheckAll(
     PERROR error = errorNotImplemented;
 
     // Only handle if a region was defined
-    if (m_ramRegion[0].end != 0)
+    if (CRegion::count(m_ramRegion) != 0)
     {
         CRamCheck ramCheck( m_cpu,
                             m_delayFunction,
                             m_ramRegion,
                             m_ramRegionByteOnly,
                             m_ramRegionWriteOnly,
-                            (void *) this );
+                            (void *) this,
+                            m_addressOffset,
+                            cpu() );
 
         error = ramCheck.check();
     }
@@ -170,14 +158,16 @@ CGame::ramCheckAllChipSelect(
     PERROR error = errorNotImplemented;
 
     // Only handle if a region was defined
-    if (m_ramRegion[0].end != 0)
+    if (CRegion::count(m_ramRegion) != 0)
     {
         CRamCheck ramCheck( m_cpu,
                             m_delayFunction,
                             m_ramRegion,
                             m_ramRegionByteOnly,
                             m_ramRegionWriteOnly,
-                            (void *) this );
+                            (void *) this,
+                            m_addressOffset,
+                            cpu() );
 
         error = ramCheck.checkChipSelect();
     }
@@ -193,14 +183,16 @@ CGame::ramCheckAllRandomAccess(
     PERROR error = errorNotImplemented;
 
     // Only handle if a region was defined
-    if (m_ramRegionByteOnly[0].end != 0)
+    if (CRegion::count(m_ramRegionByteOnly) != 0)
     {
         CRamCheck ramCheck( m_cpu,
                             m_delayFunction,
                             m_ramRegion,
                             m_ramRegionByteOnly,
                             m_ramRegionWriteOnly,
-                            (void *) this );
+                            (void *) this,
+                            m_addressOffset,
+                            cpu() );
 
         error = ramCheck.checkRandomAccess();
     }
@@ -217,10 +209,12 @@ CGame::interruptCheck(
     UINT16 response = 0;
 
     errorCustom->code = ERROR_SUCCESS;
-    errorCustom->description = "OK:";
+    stringCopy(errorCustom->description, "OK:");
 
     for (int i = 0 ; i < 4 ; i++)
     {
+        YIELD_CHECK_ABORT_BREAK(error);
+
         error = m_cpu->waitForInterrupt(m_interrupt,
                                         true,
                                         3000);
@@ -237,7 +231,7 @@ CGame::interruptCheck(
                 break;
             }
 
-            CHECK_VALUE_UINT8_BREAK(error, String("Int"), i, m_interruptResponse, response);
+            CHECK_VALUE_UINT8_BREAK(error, "Int", i, m_interruptResponse, response);
         }
 
         error = m_cpu->waitForInterrupt(m_interrupt,
@@ -268,11 +262,15 @@ CGame::romCheck(
 
     if (key == SELECT_KEY)
     {
-        const ROM_REGION *region = &m_romRegion[m_RomReadRegion];
+        ROM_REGION cachedRegion;
+        const ROM_REGION *region = &cachedRegion;
+
+        CRegion::get(m_romRegion, m_RomReadRegion, &cachedRegion);
 
         CRomCheck romCheck( m_cpu,
                             m_romRegion,
-                            (void *) this );
+                            (void *) this,
+                            (m_romData2n != NULL) );
 
         error = romCheck.check(region);
     }
@@ -294,11 +292,15 @@ CGame::romCrc(
 
     if (key == SELECT_KEY)
     {
-        const ROM_REGION *region = &m_romRegion[m_RomReadRegion];
+        ROM_REGION cachedRegion;
+        const ROM_REGION *region = &cachedRegion;
+
+        CRegion::get(m_romRegion, m_RomReadRegion, &cachedRegion);
 
         CRomCheck romCheck( m_cpu,
                             m_romRegion,
-                            (void *) this );
+                            (void *) this,
+                            (m_romData2n != NULL) );
 
         UINT32 crc = 0;
 
@@ -309,8 +311,8 @@ CGame::romCrc(
             error = errorCustom;
 
             error->code = ERROR_SUCCESS;
-            error->description = "OK:";
-            error->description += region->location;
+            stringCopy(error->description, "OK:");
+            stringAppend(error->description, region->location);
             STRING_UINT32_HEX(error->description, crc);
         }
     }
@@ -332,11 +334,15 @@ CGame::romRead(
 
     if (key == SELECT_KEY)
     {
-        const ROM_REGION *region = &m_romRegion[m_RomReadRegion];
+        ROM_REGION cachedRegion;
+        const ROM_REGION *region = &cachedRegion;
+
+        CRegion::get(m_romRegion, m_RomReadRegion, &cachedRegion);
 
         CRomCheck romCheck( m_cpu,
                             m_romRegion,
-                            (void *) this );
+                            (void *) this,
+                            (m_romData2n != NULL) );
 
         error = romCheck.readData(region);
     }
@@ -357,18 +363,23 @@ CGame::ramCheck(
     PERROR error = errorNotImplemented;
 
     // Only handle if a region was defined
-    if (m_ramRegion[0].end != 0)
+    if (CRegion::count(m_ramRegion) != 0)
     {
         if (key == SELECT_KEY)
         {
-            const RAM_REGION *region = &m_ramRegion[m_RamWriteReadRegion];
+            RAM_REGION cachedRegion;
+            const RAM_REGION *region = &cachedRegion;
+
+            CRegion::get(m_ramRegion, m_RamWriteReadRegion, &cachedRegion, m_addressOffset);
 
             CRamCheck ramCheck( m_cpu,
                                 m_delayFunction,
                                 m_ramRegion,
                                 m_ramRegionByteOnly,
                                 m_ramRegionWriteOnly,
-                                (void *) this );
+                                (void *) this,
+                                m_addressOffset,
+                                cpu() );
 
             error = ramCheck.check(region);
         }
@@ -390,18 +401,23 @@ CGame::ramCheckRandomAccess(
     PERROR error = errorNotImplemented;
 
     // Only handle if a region was defined
-    if (m_ramRegionByteOnly[0].end != 0)
+    if (CRegion::count(m_ramRegionByteOnly) != 0)
     {
         if (key == SELECT_KEY)
         {
-            const RAM_REGION *region = &m_ramRegionByteOnly[m_RamWriteReadByteRegion];
+            RAM_REGION cachedRegion;
+            const RAM_REGION *region = &cachedRegion;
+
+            CRegion::get(m_ramRegionByteOnly, m_RamWriteReadByteRegion, &cachedRegion, m_addressOffset);
 
             CRamCheck ramCheck( m_cpu,
                                 m_delayFunction,
                                 m_ramRegion,
                                 m_ramRegionByteOnly,
                                 m_ramRegionWriteOnly,
-                                (void *) this );
+                                (void *) this,
+                                m_addressOffset,
+                                cpu() );
 
             error = ramCheck.checkRandomAccess(region);
         }
@@ -422,18 +438,23 @@ CGame::ramCheckAddress(
     PERROR error = errorNotImplemented;
 
     // Only handle if a region was defined
-    if (m_ramRegion[0].end != 0)
+    if (CRegion::count(m_ramRegion) != 0)
     {
         if (key == SELECT_KEY)
         {
-            const RAM_REGION *region = &m_ramRegion[m_RamWriteReadRegion];
+            RAM_REGION cachedRegion;
+            const RAM_REGION *region = &cachedRegion;
+
+            CRegion::get(m_ramRegion, m_RamWriteReadRegion, &cachedRegion, m_addressOffset);
 
             CRamCheck ramCheck( m_cpu,
                                 m_delayFunction,
                                 m_ramRegion,
                                 m_ramRegionByteOnly,
                                 m_ramRegionWriteOnly,
-                                (void *) this );
+                                (void *) this,
+                                m_addressOffset,
+                                cpu() );
 
             error = ramCheck.checkAddress(region);
         }
@@ -455,18 +476,23 @@ CGame::ramWriteRead(
     PERROR error = errorNotImplemented;
 
     // Only handle if a region was defined
-    if (m_ramRegion[0].end != 0)
+    if (CRegion::count(m_ramRegion) != 0)
     {
         if (key == SELECT_KEY)
         {
-            const RAM_REGION *region = &m_ramRegion[m_RamWriteReadRegion];
+            RAM_REGION cachedRegion;
+            const RAM_REGION *region = &cachedRegion;
+
+            CRegion::get(m_ramRegion, m_RamWriteReadRegion, &cachedRegion, m_addressOffset);
 
             CRamCheck ramCheck( m_cpu,
                                 m_delayFunction,
                                 m_ramRegion,
                                 m_ramRegionByteOnly,
                                 m_ramRegionWriteOnly,
-                                (void *) this );
+                                (void *) this,
+                                m_addressOffset,
+                                cpu() );
 
             error = ramCheck.writeReadData(region);
         }
@@ -489,7 +515,8 @@ CGame::romReadAll(
 
     CRomCheck romCheck( m_cpu,
                         m_romRegion,
-                        (void *) this );
+                        (void *) this,
+                        (m_romData2n != NULL) );
 
     error = romCheck.read();
 
@@ -509,7 +536,9 @@ CGame::ramWriteAllAD(
                         m_ramRegion,
                         m_ramRegionByteOnly,
                         m_ramRegionWriteOnly,
-                        (void *) this );
+                        (void *) this,
+                        m_addressOffset,
+                        cpu() );
 
     error = ramCheck.write();
 
@@ -529,7 +558,9 @@ CGame::ramWriteAllLo(
                         m_ramRegion,
                         m_ramRegionByteOnly,
                         m_ramRegionWriteOnly,
-                        (void *) this );
+                        (void *) this,
+                        m_addressOffset,
+                        cpu() );
 
     error = ramCheck.write( (UINT8) 0x00 );
 
@@ -549,7 +580,9 @@ CGame::ramWriteAllHi(
                         m_ramRegion,
                         m_ramRegionByteOnly,
                         m_ramRegionWriteOnly,
-                        (void *) this );
+                        (void *) this,
+                        m_addressOffset,
+                        cpu() );
 
     error = ramCheck.write( (UINT8) 0xFF );
 
@@ -569,7 +602,9 @@ CGame::ramReadAll(
                         m_ramRegion,
                         m_ramRegionByteOnly,
                         m_ramRegionWriteOnly,
-                        (void *) this );
+                        (void *) this,
+                        m_addressOffset,
+                        cpu() );
 
     error = ramCheck.read();
 
@@ -594,14 +629,17 @@ CGame::inputRead(
 
     if (key == UP_KEY)
     {
-        if (m_inputRegion[m_inputReadRegion+1].mask != 0)
+        if ((m_inputReadRegion+1) < CRegion::count(m_inputRegion))
         {
             m_inputReadRegion++;
         }
     }
 
     {
-        const INPUT_REGION *region = &m_inputRegion[m_inputReadRegion];
+        INPUT_REGION cachedRegion;
+        const INPUT_REGION *region = &cachedRegion;
+
+        CRegion::get(m_inputRegion, m_inputReadRegion, &cachedRegion, m_addressOffset);
 
         if (key == SELECT_KEY)
         {
@@ -657,14 +695,18 @@ CGame::outputWrite(
 
     if (key == UP_KEY)
     {
-        if (m_outputRegion[m_outputWriteRegion+1].activeMask != 0)
+        if ((m_outputWriteRegion+1) < CRegion::count(m_outputRegion))
         {
             m_outputWriteRegion++;
         }
     }
 
     {
-        const OUTPUT_REGION *region = &m_outputRegion[m_outputWriteRegion];
+        OUTPUT_REGION cachedRegion;
+        const OUTPUT_REGION *region = &cachedRegion;
+
+        CRegion::get(m_outputRegion, m_outputWriteRegion, &cachedRegion, m_addressOffset);
+
         UINT8 dataAccessWidth = m_cpu->dataAccessWidth(region->address);
 
         if (key == SELECT_KEY)
@@ -715,13 +757,15 @@ CGame::custom(
     // Only handle custom functions if custom functions have been
     // implemented
     //
-    if (m_customFunction[0].function != NULL)
+    if (CRegion::count(m_customFunction) != 0)
     {
         if (key == SELECT_KEY)
         {
-            CustomFunctionCallback function = m_customFunction[m_customSelect].function;
+            CUSTOM_FUNCTION customFunction;
 
-            error = function(this);
+            CRegion::get(m_customFunction, m_customSelect, &customFunction);
+
+            error = customFunction.function(this);
         }
         else
         {
@@ -733,6 +777,329 @@ CGame::custom(
 }
 
 
+//
+// The bus stats are shown one counter per screen, the counters first and
+// then the cycle time histogram buckets.
+//
+static const char s_busStatsReads[]      PROGMEM = "Reads ";
+static const char s_busStatsWrites[]     PROGMEM = "Writes ";
+static const char s_busStatsIo[]         PROGMEM = "IO ";
+static const char s_busStatsWait[]       PROGMEM = "Wait ";
+static const char s_busStatsWaitPolls[]  PROGMEM = "Polls/W ";
+static const char s_busStatsTimeouts[]   PROGMEM = "Timeouts ";
+static const char s_busStatsIntAcks[]    PROGMEM = "Int Acks ";
+
+static const char* const s_busStatsDescription[] PROGMEM = { s_busStatsReads,
+                                                             s_busStatsWrites,
+                                                             s_busStatsIo,
+                                                             s_busStatsWait,
+                                                             s_busStatsWaitPolls,
+                                                             s_busStatsTimeouts,
+                                                             s_busStatsIntAcks };
+
+static const int c_busStatsCounters = sizeof(s_busStatsDescription) / sizeof(s_busStatsDescription[0]);
+
+PERROR
+CGame::busStats(
+    int key
+)
+{
+#if CPU_BUS_STATS
+    PERROR error = errorSuccess;
+    const BUS_STATS *stats = m_cpu->busStats();
+
+    if (key == DOWN_KEY)
+    {
+        if (m_busStatsSelect > 0)
+        {
+            m_busStatsSelect--;
+        }
+    }
+
+    if (key == UP_KEY)
+    {
+        if ((m_busStatsSelect+1) < (c_busStatsCounters + BUS_STATS_BUCKETS))
+        {
+            m_busStatsSelect++;
+        }
+    }
+
+    if (key == SELECT_KEY)
+    {
+        m_cpu->clearBusStats();
+
+        errorCustom->code = ERROR_SUCCESS;
+        stringCopy(errorCustom->description, "OK: Cleared");
+    }
+    else if (m_busStatsSelect < c_busStatsCounters)
+    {
+        UINT32 value = 0;
+        char label[10];
+
+        strcpy_P(label, (PGM_P) pgm_read_word(&s_busStatsDescription[m_busStatsSelect]));
+
+        switch (m_busStatsSelect)
+        {
+            case 0  : value = stats->reads;         break;
+            case 1  : value = stats->writes;        break;
+            case 2  : value = stats->ioCycles;      break;
+            case 3  : value = stats->waitCycles;    break;
+            case 4  : value = (stats->waitCycles != 0) ? (stats->waitPolls / stats->waitCycles) : 0; break;
+            case 5  : value = stats->timeouts;      break;
+            default : value = stats->interruptAcks; break;
+        }
+
+        errorCustom->code = ERROR_SUCCESS;
+        stringCopy(errorCustom->description, " ");
+        stringAppend(errorCustom->description, label);
+        stringAppendDec(errorCustom->description, value);
+    }
+    else
+    {
+        //
+        // Bucket n holds accesses of 2^(n-1) to 2^n - 1 Timer0 ticks (4us each).
+        //
+        UINT8 bucket = (UINT8) (m_busStatsSelect - c_busStatsCounters);
+
+        errorCustom->code = ERROR_SUCCESS;
+
+        if (bucket == 0)
+        {
+            stringCopy(errorCustom->description, " <4us ");
+        }
+        else
+        {
+            stringCopy(errorCustom->description, " ");
+            stringAppendDec(errorCustom->description, ((UINT32) 4) << (bucket - 1));
+            stringAppend(errorCustom->description, (bucket == (BUS_STATS_BUCKETS - 1)) ? "us+ " : "us ");
+        }
+
+        stringAppendDec(errorCustom->description, stats->cycleTicks[bucket]);
+    }
+
+    if (SUCCESS(error))
+    {
+        error = errorCustom;
+    }
+
+    return error;
+#else
+    return errorNotImplemented;
+#endif
+}
+
+
+//
+// The first entries loop on the RAM region selected by "RAM Write-Read" and
+// the rest on the ROM region selected by "ROM Read".
+//
+static const char s_scopeLoopRamRead[]   PROGMEM = "RAM Rd ";
+static const char s_scopeLoopRamWrite0[] PROGMEM = "RAM Wr00 ";
+static const char s_scopeLoopRamWriteF[] PROGMEM = "RAM WrFF ";
+static const char s_scopeLoopRamWrite5[] PROGMEM = "RAM Wr55 ";
+static const char s_scopeLoopRamWriteA[] PROGMEM = "RAM WrAA ";
+static const char s_scopeLoopRamRamp[]   PROGMEM = "RAM Ramp ";
+static const char s_scopeLoopRamToggle[] PROGMEM = "RAM Tog ";
+static const char s_scopeLoopRamWalk[]   PROGMEM = "RAM Walk ";
+static const char s_scopeLoopRomRead[]   PROGMEM = "ROM Rd ";
+static const char s_scopeLoopRomRamp[]   PROGMEM = "ROM Ramp ";
+static const char s_scopeLoopRomWalk[]   PROGMEM = "ROM Walk ";
+
+static const char* const s_scopeLoopDescription[] PROGMEM = { s_scopeLoopRamRead,
+                                                              s_scopeLoopRamWrite0,
+                                                              s_scopeLoopRamWriteF,
+                                                              s_scopeLoopRamWrite5,
+                                                              s_scopeLoopRamWriteA,
+                                                              s_scopeLoopRamRamp,
+                                                              s_scopeLoopRamToggle,
+                                                              s_scopeLoopRamWalk,
+                                                              s_scopeLoopRomRead,
+                                                              s_scopeLoopRomRamp,
+                                                              s_scopeLoopRomWalk };
+
+static const UINT8 s_scopeLoopMode[] PROGMEM = { CScopeLoop::READ_LOOP,
+                                                 CScopeLoop::WRITE_LOOP,
+                                                 CScopeLoop::WRITE_LOOP,
+                                                 CScopeLoop::WRITE_LOOP,
+                                                 CScopeLoop::WRITE_LOOP,
+                                                 CScopeLoop::ADDRESS_RAMP,
+                                                 CScopeLoop::DATA_TOGGLE,
+                                                 CScopeLoop::ADDRESS_WALK,
+                                                 CScopeLoop::READ_LOOP,
+                                                 CScopeLoop::ADDRESS_RAMP,
+                                                 CScopeLoop::ADDRESS_WALK };
+
+//
+// The data written by each RAM mode, only used by the write loops.
+//
+static const UINT16 s_scopeLoopData[] PROGMEM = { 0x0000,
+                                                  0x0000,
+                                                  0xFFFF,
+                                                  0x5555,
+                                                  0xAAAA,
+                                                  0x0000,
+                                                  0x0000,
+                                                  0x0000 };
+
+static const int c_scopeLoopRamModes = 8;
+static const int c_scopeLoopModes    = sizeof(s_scopeLoopMode) / sizeof(s_scopeLoopMode[0]);
+
+PERROR
+CGame::scopeLoop(
+    int key
+)
+{
+    PERROR error = errorSuccess;
+    RAM_REGION ramRegion;
+    ROM_REGION romRegion;
+    UINT32 start = 0;
+    bool rom;
+
+    if (key == DOWN_KEY)
+    {
+        if (m_scopeLoopSelect > 0)
+        {
+            m_scopeLoopSelect--;
+        }
+    }
+
+    if (key == UP_KEY)
+    {
+        if ((m_scopeLoopSelect+1) < c_scopeLoopModes)
+        {
+            m_scopeLoopSelect++;
+        }
+    }
+
+    rom = (m_scopeLoopSelect >= c_scopeLoopRamModes);
+
+    if (rom)
+    {
+        if (CRegion::count(m_romRegion) != 0)
+        {
+            CRegion::get(m_romRegion, m_RomReadRegion, &romRegion);
+            start = romRegion.start;
+        }
+        else
+        {
+            error = errorNotImplemented;
+        }
+    }
+    else
+    {
+        if (CRegion::count(m_ramRegion) != 0)
+        {
+            CRegion::get(m_ramRegion, m_RamWriteReadRegion, &ramRegion, m_addressOffset);
+            start = ramRegion.start;
+        }
+        else
+        {
+            error = errorNotImplemented;
+        }
+    }
+
+    if (FAILED(error))
+    {
+        // Nothing to loop on for this target.
+    }
+    else if (key == SELECT_KEY)
+    {
+        CScopeLoop scopeLoop( cpu(), (void *) this );
+        CScopeLoop::Mode mode = (CScopeLoop::Mode) pgm_read_byte(&s_scopeLoopMode[m_scopeLoopSelect]);
+
+        if (rom)
+        {
+            error = scopeLoop.run(mode, &romRegion);
+        }
+        else
+        {
+            error = scopeLoop.run(mode, &ramRegion, pgm_read_word(&s_scopeLoopData[m_scopeLoopSelect]));
+        }
+    }
+    else
+    {
+        char label[10];
+
+        strcpy_P(label, (PGM_P) pgm_read_word(&s_scopeLoopDescription[m_scopeLoopSelect]));
+
+        errorCustom->code = ERROR_SUCCESS;
+        stringCopy(errorCustom->description, " ");
+        stringAppend(errorCustom->description, label);
+        stringAppendHex(errorCustom->description, start, (start > 0xFFFF) ? 6 : 4);
+
+        error = errorCustom;
+    }
+
+    return error;
+}
+
+
+ICpu *
+CGame::cpu(
+)
+{
+    if ((m_traceCpu != NULL) && (m_cpu == m_traceCpu))
+    {
+        return m_traceCpu->cpu();
+    }
+
+    return m_cpu;
+}
+
+
+//
+// Only m_cpu is swapped, so bus accesses made through objects that took a
+// copy of the CPU at construction aren't traced.
+//
+void
+CGame::trace(
+    bool enable
+)
+{
+    if (enable)
+    {
+        if (m_traceCpu == NULL)
+        {
+            m_traceCpu = new CTraceCpu(m_cpu);
+        }
+
+        m_cpu = m_traceCpu;
+    }
+    else if ((m_traceCpu != NULL) && (m_cpu == m_traceCpu))
+    {
+        m_cpu = m_traceCpu->cpu();
+    }
+}
+
+
+int
+CGame::selection(
+    Selection which
+)
+{
+    switch (which)
+    {
+        case ROM_SELECTION      : return m_RomReadRegion;
+        case RAM_SELECTION      : return m_RamWriteReadRegion;
+        case RAM_BYTE_SELECTION : return m_RamWriteReadByteRegion;
+        case INPUT_SELECTION    : return m_inputReadRegion;
+        case OUTPUT_SELECTION   : return m_outputWriteRegion;
+        case CUSTOM_SELECTION   : return m_customSelect;
+        default                 : return 0;
+    }
+}
+
+
+UINT32
+CGame::busCycles(
+)
+{
+    const BUS_STATS *busStats = m_cpu->busStats();
+
+    return (busStats->reads + busStats->writes);
+}
+
+
 PERROR
 CGame::onRomKeyMove(
     int key
@@ -750,7 +1117,7 @@ CGame::onRomKeyMove(
 
     if (key == UP_KEY)
     {
-        if (m_romRegion[m_RomReadRegion+1].length != 0)
+        if ((m_RomReadRegion+1) < CRegion::count(m_romRegion))
         {
             m_RomReadRegion++;
         }
@@ -758,7 +1125,11 @@ CGame::onRomKeyMove(
 
     if (key != SELECT_KEY)
     {
-        const ROM_REGION *region = &m_romRegion[m_RomReadRegion];
+        ROM_REGION cachedRegion;
+        const ROM_REGION *region = &cachedRegion;
+
+        CRegion::get(m_romRegion, m_RomReadRegion, &cachedRegion);
+
         UINT8 dataAccessWidth = m_cpu->dataAccessWidth(region->start);
 
         if (dataAccessWidth == 1)
@@ -801,7 +1172,7 @@ CGame::onRamKeyMove(
 
     if (key == UP_KEY)
     {
-        if (m_ramRegion[m_RamWriteReadRegion+1].end != 0)
+        if ((m_RamWriteReadRegion+1) < CRegion::count(m_ramRegion))
         {
             m_RamWriteReadRegion++;
         }
@@ -809,7 +1180,11 @@ CGame::onRamKeyMove(
 
     if (key != SELECT_KEY)
     {
-        const RAM_REGION *region = &m_ramRegion[m_RamWriteReadRegion];
+        RAM_REGION cachedRegion;
+        const RAM_REGION *region = &cachedRegion;
+
+        CRegion::get(m_ramRegion, m_RamWriteReadRegion, &cachedRegion, m_addressOffset);
+
         UINT8 dataAccessWidth = m_cpu->dataAccessWidth(region->start);
 
         if (dataAccessWidth == 1)
@@ -852,7 +1227,7 @@ CGame::onRamByteKeyMove(
 
     if (key == UP_KEY)
     {
-        if (m_ramRegionByteOnly[m_RamWriteReadByteRegion+1].end != 0)
+        if ((m_RamWriteReadByteRegion+1) < CRegion::count(m_ramRegionByteOnly))
         {
             m_RamWriteReadByteRegion++;
         }
@@ -860,7 +1235,11 @@ CGame::onRamByteKeyMove(
 
     if (key != SELECT_KEY)
     {
-        const RAM_REGION *region = &m_ramRegionByteOnly[m_RamWriteReadByteRegion];
+        RAM_REGION cachedRegion;
+        const RAM_REGION *region = &cachedRegion;
+
+        CRegion::get(m_ramRegionByteOnly, m_RamWriteReadByteRegion, &cachedRegion, m_addressOffset);
+
         UINT8 dataAccessWidth = m_cpu->dataAccessWidth(region->start);
 
         if (dataAccessWidth == 1)
@@ -903,7 +1282,7 @@ CGame::onCustomKeyMove(
 
     if (key == UP_KEY)
     {
-        if (m_customFunction[m_customSelect+1].function != NULL)
+        if ((m_customSelect+1) < CRegion::count(m_customFunction))
         {
             m_customSelect++;
         }
@@ -911,11 +1290,13 @@ CGame::onCustomKeyMove(
 
     if (key != SELECT_KEY)
     {
-        const CUSTOM_FUNCTION *customFunction = &m_customFunction[m_customSelect];
+        CUSTOM_FUNCTION customFunction;
+
+        CRegion::get(m_customFunction, m_customSelect, &customFunction);
 
         errorCustom->code        = ERROR_SUCCESS;
-        errorCustom->description = " ";
-        errorCustom->description += customFunction->description;
+        stringCopy(errorCustom->description, " ");
+        stringAppend(errorCustom->description, customFunction.description);
     }
 
     if (SUCCESS(error))
@@ -949,36 +1330,22 @@ void CGame::constructor(
     m_outputWriteRegion      = 0;
     m_outputWriteRegionOn    = true;
     m_customSelect           = 0;
+    m_busStatsSelect         = 0;
+    m_scopeLoopSelect        = 0;
+    m_traceCpu               = (CTraceCpu *) NULL;
+    m_addressOffset          = 0;
 
-    m_romRegion = mallocProgMem(romRegion);
-
-    if (romData2n != 0)
-    {
-        m_romData2n = mallocProgMem(romData2n, m_romRegion);
-    }
-    else
-    {
-        m_romData2n = 0;
-    }
-
-    m_ramRegion = mallocProgMem(ramRegion);
-
-    if (ramRegion != ramRegionByteOnly)
-    {
-        m_ramRegionByteOnly = mallocProgMem(ramRegionByteOnly);
-    }
-    else
-    {
-        m_ramRegionByteOnly = m_ramRegion;
-    }
-
-    m_ramRegionWriteOnly = mallocProgMem(ramRegionWriteOnly);
-
-    m_inputRegion = mallocProgMem(inputRegion);
-
-    m_outputRegion = mallocProgMem(outputRegion);
-
-    m_customFunction = mallocProgMem(customFunction);
+    //
+    // The tables are used directly from PROGMEM rather than copied into SRAM.
+    //
+    m_romData2n          = romData2n;
+    m_romRegion          = romRegion;
+    m_ramRegion          = ramRegion;
+    m_ramRegionByteOnly  = ramRegionByteOnly;
+    m_ramRegionWriteOnly = ramRegionWriteOnly;
+    m_inputRegion        = inputRegion;
+    m_outputRegion       = outputRegion;
+    m_customFunction     = customFunction;
 
     // Select the default if none was provided
     if (delayFunction == NO_DELAY_FUNCTION)
@@ -992,189 +1359,12 @@ void CGame::constructor(
 }
 
 
-//
-// Copy the PROGMEM based region into local SRAM.
-// Also updates the romRegion (that must be in SRAM) to
-// point to the SRAM-based entries in romData2n.
-//
-ROM_DATA2N* CGame::mallocProgMem(
-    const ROM_DATA2N *romData2n,
-    ROM_REGION *romRegion
-)
-{
-    ROM_DATA2N *retRomData2n;
-    UINT16 uRegionSize = 0;
-    UINT16 uIndexCount;
-
-    // The number of entries is determined from the romRegion
-    for (uIndexCount = 0 ; (romRegion[uIndexCount].length != 0) ; uIndexCount++) {}
-
-    uRegionSize = sizeof(romData2n[0]) * (uIndexCount+1);
-
-    retRomData2n = (PROM_DATA2N) malloc( uRegionSize );
-
-    memcpy_P(retRomData2n, romData2n, uRegionSize);
-
-    // Update the data2n pointers in the romRegion to reference SRAM
-    for (uIndexCount = 0 ; (romRegion[uIndexCount].length != 0) ; uIndexCount++)
-    {
-        romRegion[uIndexCount].data2n = retRomData2n[uIndexCount].data2n;
-    }
-
-    return retRomData2n;
-}
-
-
-//
-// Copy the PROGMEM based region into local SRAM.
-//
-ROM_REGION* CGame::mallocProgMem(
-    const ROM_REGION *romRegion
-)
-{
-    ROM_REGION *retRomRegion;
-    UINT16 uIndexCount = 0;
-    UINT16 uRegionSize = 0;
-
-    for ( ;
-          ((pgm_read_word_near((UINT16*) (&romRegion[uIndexCount].length) + 0) != 0) ||
-           (pgm_read_word_near((UINT16*) (&romRegion[uIndexCount].length) + 1) != 0)) ;
-          uIndexCount++) {}
-
-    uRegionSize = sizeof(romRegion[0]) * (uIndexCount+1);
-
-    retRomRegion = (PROM_REGION) malloc( uRegionSize );
-
-    memcpy_P(retRomRegion, romRegion, uRegionSize);
-
-    return retRomRegion;
-}
-
-
-// Copy the PROGMEM based region into local SRAM.
-RAM_REGION* CGame::mallocProgMem(
-    const RAM_REGION *ramRegion
-)
-{
-    RAM_REGION *retRamRegion;
-    UINT16 uIndexCount = 0;
-    UINT16 uRegionSize = 0;
-
-    for ( ;
-          ((pgm_read_word_near((UINT16*) (&ramRegion[uIndexCount].end) + 0) != 0) ||
-           (pgm_read_word_near((UINT16*) (&ramRegion[uIndexCount].end) + 1) != 0)) ;
-          uIndexCount++) {}
-
-    uRegionSize = sizeof(ramRegion[0]) * (uIndexCount+1);
-
-    retRamRegion = (PRAM_REGION) malloc( uRegionSize );
-
-    memcpy_P( retRamRegion, ramRegion, uRegionSize );
-
-    return retRamRegion;
-}
-
-
-// Copy the PROGMEM based region into local SRAM.
-INPUT_REGION* CGame::mallocProgMem(
-    const INPUT_REGION *inputRegion
-)
-{
-    INPUT_REGION *retInputRegion;
-    UINT16 uIndexCount = 0;
-    UINT16 uRegionSize = 0;
-
-    for ( ; pgm_read_word_near(&inputRegion[uIndexCount].mask) != 0 ; uIndexCount++) {}
-
-    uRegionSize = sizeof(inputRegion[0]) * (uIndexCount+1);
-
-    retInputRegion = (PINPUT_REGION) malloc( uRegionSize );
-
-    memcpy_P( retInputRegion, inputRegion, uRegionSize );
-
-    return retInputRegion;
-}
-
-
-// Copy the PROGMEM based region into local SRAM.
-OUTPUT_REGION* CGame::mallocProgMem(
-    const OUTPUT_REGION *outputRegion
-)
-{
-    OUTPUT_REGION *retOutputRegion;
-    UINT16 uIndexCount = 0;
-    UINT16 uRegionSize = 0;
-
-    for ( ; pgm_read_word_near(&outputRegion[uIndexCount].activeMask) != 0 ; uIndexCount++) {}
-
-    uRegionSize = sizeof(outputRegion[0]) * (uIndexCount+1);
-
-    retOutputRegion = (POUTPUT_REGION) malloc( uRegionSize );
-
-    memcpy_P( retOutputRegion, outputRegion, uRegionSize );
-
-    return retOutputRegion;
-}
-
-
-// Copy the PROGMEM based region into local SRAM.
-CUSTOM_FUNCTION* CGame::mallocProgMem(
-    const CUSTOM_FUNCTION *customFunction
-)
-{
-    CUSTOM_FUNCTION *retCustomFunction;
-    UINT16 uIndexCount = 0;
-    UINT16 uRegionSize = 0;
-
-    for ( ; pgm_read_ptr_near(&customFunction[uIndexCount].function) != NULL ; uIndexCount++) {}
-
-    uRegionSize = sizeof(customFunction[0]) * (uIndexCount+1);
-
-    retCustomFunction = (PCUSTOM_FUNCTION) malloc( uRegionSize );
-
-    memcpy_P( retCustomFunction, customFunction, uRegionSize );
-
-    return retCustomFunction;
-}
-
-
-// Add an offset to the start and end addresses.
-void CGame::addAddressOffset(
-    RAM_REGION *ramRegion,
-    UINT32 offset
-)
-{
-    for ( UINT16 i = 0 ; ramRegion[i].end != 0 ; i++ )
-    {
-        ramRegion[i].start += offset;
-        ramRegion[i].end   += offset;
-    }
-}
-
-
-// Add an offset to the address.
-void CGame::addAddressOffset(
-    INPUT_REGION *inputRegion,
-    UINT32 offset
-)
-{
-    for ( UINT16 i = 0 ; inputRegion[i].mask != 0 ; i++ )
-    {
-        inputRegion[i].address += offset;
-    }
-}
-
-
-// Add an offset to the address.
+// Add an offset to the RAM & IO region addresses.
 void CGame::addAddressOffset(
-    OUTPUT_REGION *outputRegion,
     UINT32 offset
 )
 {
-    for ( UINT16 i = 0 ; outputRegion[i].activeMask != 0 ; i++ )
-    {
-        outputRegion[i].address += offset;
-    }
+    m_addressOffset += offset;
 }
 
 
@@ -1185,8 +1375,18 @@ PERROR CGame::delayFunction(
 )
 {
     // NOTE: The context supplied is an ICpu object.
-    delay(ms);
-    return ERROR_SUCCESS;
+    PERROR error = errorSuccess;
+    unsigned long startTime = millis();
+
+    //
+    // Delay in small steps so that an abort request is seen.
+    //
+    while ((millis() - startTime) < ms)
+    {
+        YIELD_CHECK_ABORT_BREAK(error);
+    }
+
+    return error;
 }
 
 
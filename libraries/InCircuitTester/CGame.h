@@ -27,6 +27,7 @@
 
 #include "IGame.h"
 #include "ICpu.h"
+#include "CTraceCpu.h"
 
 class CGame : public IGame
 {
@@ -117,6 +118,25 @@ class CGame : public IGame
             int key
         );
 
+        virtual PERROR busStats(
+            int key
+        );
+
+        virtual PERROR scopeLoop(
+            int key
+        );
+
+        virtual void trace(
+            bool enable
+        );
+
+        virtual int selection(
+            Selection which
+        );
+
+        virtual UINT32 busCycles(
+        );
+
         virtual PERROR onRomKeyMove(
             int key
         );
@@ -137,8 +157,8 @@ class CGame : public IGame
 
         //
         // NOTE: These are all assumed to be defined in PROGMEM since
-        // they are large data structures. The constructor will copy them
-        // over to SRAM.
+        // they are large data structures. They are used in place and
+        // read through CRegion one entry at a time.
         //
 
         CGame(
@@ -182,52 +202,20 @@ class CGame : public IGame
         );
 
         //
-        // These utilities allocate the associated region and perform a
-        // PROGMEM copy from the supplied PROGMEM constant into it.
+        // Add an offset to the RAM & IO region addresses to allow the
+        // whole address space to be dynamically moved.
         //
-        ROM_DATA2N* mallocProgMem(
-            const ROM_DATA2N *romData2n,
-            ROM_REGION *romRegion
-        );
-
-        ROM_REGION* mallocProgMem(
-            const ROM_REGION *romRegion
-        );
-
-        RAM_REGION* mallocProgMem(
-            const RAM_REGION *ramRegion
-        );
-
-        INPUT_REGION* mallocProgMem(
-            const INPUT_REGION *inputRegion
-        );
-
-        OUTPUT_REGION* mallocProgMem(
-            const OUTPUT_REGION *outputRegion
-        );
-
-        CUSTOM_FUNCTION* mallocProgMem(
-            const CUSTOM_FUNCTION *customFunction
-        );
-
-        //
-        // These utilities add a simple address offset to the supplied
-        // region to allow the whole address space to be dynamically moved.
-        //
-
-        void addAddressOffset(
-            RAM_REGION *ramRegion,
-            UINT32 offset
-        );
-
         void addAddressOffset(
-            INPUT_REGION *inputRegion,
             UINT32 offset
         );
 
-        void addAddressOffset(
-            OUTPUT_REGION *outputRegion,
-            UINT32 offset
+        //
+        // The CPU driver itself. While the bus trace is on m_cpu is the
+        // CTraceCpu wrapper, so this is the one to cast to the concrete
+        // driver (or IClockMasterCpu) and to give as the delay function
+        // context.
+        //
+        ICpu *cpu(
         );
 
         //
@@ -240,18 +228,23 @@ class CGame : public IGame
         );
 
         //
-        // These are filled in by the derived concrete game and are SRAM copies
-        // of the supplied PROGMEM source data.
+        // These are supplied by the derived concrete game and are the PROGMEM
+        // source data. m_romData2n is NULL for the legacy SRAM data2n.
         //
 
-        ROM_DATA2N      *m_romData2n;
-        ROM_REGION      *m_romRegion;
-        RAM_REGION      *m_ramRegion;
-        RAM_REGION      *m_ramRegionByteOnly;
-        RAM_REGION      *m_ramRegionWriteOnly;
-        INPUT_REGION    *m_inputRegion;
-        OUTPUT_REGION   *m_outputRegion;
-        CUSTOM_FUNCTION *m_customFunction;
+        const ROM_DATA2N      *m_romData2n;
+        const ROM_REGION      *m_romRegion;
+        const RAM_REGION      *m_ramRegion;
+        const RAM_REGION      *m_ramRegionByteOnly;
+        const RAM_REGION      *m_ramRegionWriteOnly;
+        const INPUT_REGION    *m_inputRegion;
+        const OUTPUT_REGION   *m_outputRegion;
+        const CUSTOM_FUNCTION *m_customFunction;
+
+        //
+        // Offset added to the RAM & IO region addresses.
+        //
+        UINT32                 m_addressOffset;
 
         //
         // The delay function to use for some tests
@@ -259,11 +252,18 @@ class CGame : public IGame
         DelayFunctionCallback m_delayFunction;
 
         //
-        // The applicable processor for this game.
+        // The applicable processor for this game, swapped for the trace
+        // wrapper while the bus trace is on (see cpu()).
         //
 
         ICpu *m_cpu;
 
+        //
+        // Created the first time the trace is turned on and swapped in for
+        // m_cpu whilst it's on.
+        //
+        CTraceCpu *m_traceCpu;
+
         //
         // The interrupt pin to use for the video interrupt test.
         //
@@ -294,6 +294,16 @@ class CGame : public IGame
         //
         int  m_customSelect;
 
+        //
+        // The current counter shown by the bus stats.
+        //
+        int  m_busStatsSelect;
+
+        //
+        // The current scope loop mode & target.
+        //
+        int  m_scopeLoopSelect;
+
 };
 
 #endif
@@ -23,9 +23,37 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //
 #include "CGameCallback.h"
+#include "CTestTiming.h"
+#include "main.h"
 
-
-static const SELECTOR s_selectorGame[] = { //"0123456789abcdef"
+//
+// Make the IGame call for a wrapper and return the result, timing it when
+// TEST_TIMING is enabled. "which" is the sub menu whose current selection
+// is timed separately, if any.
+//
+#if TEST_TIMING
+#define TIMED_GAME_CALL(id, which, key, call)                               \
+    {                                                                       \
+        PERROR error;                                                       \
+                                                                            \
+        CTestTiming::start(game->busCycles());                              \
+        error = call;                                                       \
+        CTestTiming::stop((const void *) id,                                \
+                          game->selection(which),                           \
+                          key,                                              \
+                          game->busCycles());                               \
+                                                                            \
+        return error;                                                       \
+    }
+#else
+#define TIMED_GAME_CALL(id, which, key, call)                               \
+    {                                                                       \
+        return call;                                                        \
+    }
+#endif
+
+
+static const SELECTOR s_selectorGame[] PROGMEM = { //"0123456789abcdef"
                                             {"Bus Idle",        CGameCallback::onSelectBusIdle,        (void*) &CGameCallback::game, false},
                                             {"Bus Check",       CGameCallback::onSelectBusCheck,       (void*) &CGameCallback::game, false},
                                             {"ROM Check All",   CGameCallback::onSelectRomCheckAll,    (void*) &CGameCallback::game, false},
@@ -48,12 +76,14 @@ static const SELECTOR s_selectorGame[] = { //"0123456789abcdef"
                                             {"RAM Write All Hi",CGameCallback::onSelectRamWriteAllHi,  (void*) &CGameCallback::game, false},
                                             {"RAM Read All",    CGameCallback::onSelectRamReadAll,     (void*) &CGameCallback::game, false},
                                             {"Custom",          CGameCallback::onSelectCustom,         (void*) &CGameCallback::game, true},
+                                            {"Bus Stats",       CGameCallback::onSelectBusStats,       (void*) &CGameCallback::game, true},
+                                            {"Scope Loop",      CGameCallback::onSelectScopeLoop,      (void*) &CGameCallback::game, true},
                                             { 0, 0 }
                                          };
 
 const SELECTOR *CGameCallback::selectorGame = s_selectorGame;
 
-static const SELECTOR s_selectorGeneric[] = { //"0123456789abcdef"
+static const SELECTOR s_selectorGeneric[] PROGMEM = { //"0123456789abcdef"
                                                {"Bus Idle",        CGameCallback::onSelectBusIdle,        (void*) &CGameCallback::game, false},
                                                {"Bus Check",       CGameCallback::onSelectBusCheck,       (void*) &CGameCallback::game, false},
                                                {"ROM CRC",         CGameCallback::onSelectRomCrc,         (void*) &CGameCallback::game, true},
@@ -62,12 +92,14 @@ static const SELECTOR s_selectorGeneric[] = { //"0123456789abcdef"
                                                {"RAM Check RA",    CGameCallback::onSelectRamCheckRA,     (void*) &CGameCallback::game, true},
                                                {"RAM Check Ad",    CGameCallback::onSelectRamCheckAd,     (void*) &CGameCallback::game, true},
                                                {"RAM Write-Read",  CGameCallback::onSelectRamWriteRead,   (void*) &CGameCallback::game, true},
+                                               {"Bus Stats",       CGameCallback::onSelectBusStats,       (void*) &CGameCallback::game, true},
+                                               {"Scope Loop",      CGameCallback::onSelectScopeLoop,      (void*) &CGameCallback::game, true},
                                                { 0, 0 }
                                             };
 
 const SELECTOR *CGameCallback::selectorGeneric = s_selectorGeneric;
 
-static const SELECTOR s_selectorSoakTest[] = { //"0123456789abcdef"
+static const SELECTOR s_selectorSoakTest[] PROGMEM = { //"0123456789abcdef"
                                                 {"ROM Check All",   CGameCallback::onSelectRomCheckAll,    (void*) &CGameCallback::game, false},
                                                 {"RAM Check All",   CGameCallback::onSelectRamCheckAll,    (void*) &CGameCallback::game, false},
                                                 {"RAM Check All RA",CGameCallback::onSelectRamCheckAllRA,  (void*) &CGameCallback::game, false},
@@ -76,6 +108,7 @@ static const SELECTOR s_selectorSoakTest[] = { //"0123456789abcdef"
                                                 {"RAM Write All AD",CGameCallback::onSelectRamWriteAllAD,  (void*) &CGameCallback::game, false},
                                                 {"RAM Write All Lo",CGameCallback::onSelectRamWriteAllLo,  (void*) &CGameCallback::game, false},
                                                 {"RAM Write All Hi",CGameCallback::onSelectRamWriteAllHi,  (void*) &CGameCallback::game, false},
+                                                {"Soak Stats",      onSelectSoakStats,                     (void*) NULL,                 true},
                                                 { 0, 0 }
                                              };
 
@@ -92,7 +125,7 @@ CGameCallback::onSelectBusIdle(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->busIdle();
+    TIMED_GAME_CALL(onSelectBusIdle, IGame::NO_SELECTION, key, game->busIdle());
 }
 
 PERROR
@@ -103,7 +136,7 @@ CGameCallback::onSelectBusCheck(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->busCheck();
+    TIMED_GAME_CALL(onSelectBusCheck, IGame::NO_SELECTION, key, game->busCheck());
 }
 
 PERROR
@@ -114,7 +147,7 @@ CGameCallback::onSelectRomCheckAll(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->romCheckAll();
+    TIMED_GAME_CALL(onSelectRomCheckAll, IGame::NO_SELECTION, key, game->romCheckAll());
 }
 
 PERROR
@@ -125,7 +158,7 @@ CGameCallback::onSelectRamCheckAll(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramCheckAll();
+    TIMED_GAME_CALL(onSelectRamCheckAll, IGame::NO_SELECTION, key, game->ramCheckAll());
 }
 
 
@@ -137,7 +170,7 @@ CGameCallback::onSelectRamCheckAllCS(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramCheckAllChipSelect();
+    TIMED_GAME_CALL(onSelectRamCheckAllCS, IGame::NO_SELECTION, key, game->ramCheckAllChipSelect());
 }
 
 PERROR
@@ -148,7 +181,7 @@ CGameCallback::onSelectRamCheckAllRA(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramCheckAllRandomAccess();
+    TIMED_GAME_CALL(onSelectRamCheckAllRA, IGame::NO_SELECTION, key, game->ramCheckAllRandomAccess());
 }
 
 PERROR
@@ -159,7 +192,7 @@ CGameCallback::onSelectInterruptCheck(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->interruptCheck();
+    TIMED_GAME_CALL(onSelectInterruptCheck, IGame::NO_SELECTION, key, game->interruptCheck());
 }
 
 PERROR
@@ -170,7 +203,7 @@ CGameCallback::onSelectInputRead(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->inputRead( key );
+    TIMED_GAME_CALL(onSelectInputRead, IGame::INPUT_SELECTION, key, game->inputRead( key ));
 }
 
 PERROR
@@ -181,7 +214,7 @@ CGameCallback::onSelectOutputWrite(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->outputWrite( key );
+    TIMED_GAME_CALL(onSelectOutputWrite, IGame::OUTPUT_SELECTION, key, game->outputWrite( key ));
 }
 
 PERROR
@@ -192,7 +225,7 @@ CGameCallback::onSelectRomCheck(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->romCheck( key );
+    TIMED_GAME_CALL(onSelectRomCheck, IGame::ROM_SELECTION, key, game->romCheck( key ));
 }
 
 PERROR
@@ -203,7 +236,7 @@ CGameCallback::onSelectRomCrc(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->romCrc( key );
+    TIMED_GAME_CALL(onSelectRomCrc, IGame::ROM_SELECTION, key, game->romCrc( key ));
 }
 
 PERROR
@@ -214,7 +247,7 @@ CGameCallback::onSelectRomRead(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->romRead( key );
+    TIMED_GAME_CALL(onSelectRomRead, IGame::ROM_SELECTION, key, game->romRead( key ));
 }
 
 PERROR
@@ -225,7 +258,7 @@ CGameCallback::onSelectRamCheck(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramCheck( key );
+    TIMED_GAME_CALL(onSelectRamCheck, IGame::RAM_SELECTION, key, game->ramCheck( key ));
 }
 
 PERROR
@@ -236,7 +269,7 @@ CGameCallback::onSelectRamCheckRA(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramCheckRandomAccess( key );
+    TIMED_GAME_CALL(onSelectRamCheckRA, IGame::RAM_BYTE_SELECTION, key, game->ramCheckRandomAccess( key ));
 }
 
 PERROR
@@ -247,7 +280,7 @@ CGameCallback::onSelectRamCheckAd(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramCheckAddress( key );
+    TIMED_GAME_CALL(onSelectRamCheckAd, IGame::RAM_SELECTION, key, game->ramCheckAddress( key ));
 }
 
 PERROR
@@ -258,7 +291,7 @@ CGameCallback::onSelectRamWriteRead(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramWriteRead( key );
+    TIMED_GAME_CALL(onSelectRamWriteRead, IGame::RAM_SELECTION, key, game->ramWriteRead( key ));
 }
 
 PERROR
@@ -269,7 +302,7 @@ CGameCallback::onSelectRomReadAll(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->romReadAll( key );
+    TIMED_GAME_CALL(onSelectRomReadAll, IGame::NO_SELECTION, key, game->romReadAll( key ));
 }
 
 PERROR
@@ -280,7 +313,7 @@ CGameCallback::onSelectRamWriteAllAD(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramWriteAllAD( key );
+    TIMED_GAME_CALL(onSelectRamWriteAllAD, IGame::NO_SELECTION, key, game->ramWriteAllAD( key ));
 }
 
 PERROR
@@ -291,7 +324,7 @@ CGameCallback::onSelectRamWriteAllLo(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramWriteAllLo( key );
+    TIMED_GAME_CALL(onSelectRamWriteAllLo, IGame::NO_SELECTION, key, game->ramWriteAllLo( key ));
 }
 
 PERROR
@@ -302,7 +335,7 @@ CGameCallback::onSelectRamWriteAllHi(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramWriteAllHi( key );
+    TIMED_GAME_CALL(onSelectRamWriteAllHi, IGame::NO_SELECTION, key, game->ramWriteAllHi( key ));
 }
 
 PERROR
@@ -313,7 +346,7 @@ CGameCallback::onSelectRamReadAll(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->ramReadAll( key );
+    TIMED_GAME_CALL(onSelectRamReadAll, IGame::NO_SELECTION, key, game->ramReadAll( key ));
 }
 
 PERROR
@@ -324,6 +357,33 @@ CGameCallback::onSelectCustom(
 {
     IGame *game = *((IGame **) iGame);
 
-    return game->custom( key );
+    TIMED_GAME_CALL(onSelectCustom, IGame::CUSTOM_SELECTION, key, game->custom( key ));
+}
+
+//
+// Not timed, showing the counters doesn't touch the bus.
+//
+PERROR
+CGameCallback::onSelectBusStats(
+    void *iGame,
+    int  key
+)
+{
+    IGame *game = *((IGame **) iGame);
+
+    return game->busStats( key );
 }
 
+//
+// Not timed, the loop only ends when it's aborted.
+//
+PERROR
+CGameCallback::onSelectScopeLoop(
+    void *iGame,
+    int  key
+)
+{
+    IGame *game = *((IGame **) iGame);
+
+    return game->scopeLoop( key );
+}
@@ -35,6 +35,8 @@
 // The functions may receive: SELECT, UP & DOWN.
 // The functions may use the 2nd row of the LCD.
 //
+// The selector arrays are in PROGMEM and are read through CRegion.
+//
 class CGameCallback
 {
     public:
@@ -51,6 +53,7 @@ class CGameCallback
 
         //
         // This is the selector object array for the UI for soak test use.
+        // Sub menu selections are not run by the soak test.
         //
         static const SELECTOR *selectorSoakTest;
 
@@ -173,6 +176,16 @@ class CGameCallback
             int  key
         );
 
+        static PERROR onSelectBusStats(
+            void *iGame,
+            int  key
+        );
+
+        static PERROR onSelectScopeLoop(
+            void *iGame,
+            int  key
+        );
+
 };
 
 #endif
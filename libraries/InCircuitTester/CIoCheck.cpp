@@ -66,7 +66,7 @@ CIoCheck::input(
         error = m_cpu->memoryRead( inputRegion->address,
                                    &recData );
 
-        errorCustom->description = "OK:";
+        stringCopy(errorCustom->description, "OK:");
 
         if (dataAccessWidth == 1)
         {
@@ -122,13 +122,13 @@ CIoCheck::output(
         //
         if (on)
         {
-            errorCustom->description = "OK:On ";
+            stringCopy(errorCustom->description, "OK:On ");
 
             outData = outputRegion->invertMask ^ outputRegion->activeMask;
         }
         else
         {
-            errorCustom->description = "OK:Off";
+            stringCopy(errorCustom->description, "OK:Off");
 
             outData = outputRegion->invertMask;
         }
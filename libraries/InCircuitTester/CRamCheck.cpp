@@ -23,6 +23,8 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //
 #include "CRamCheck.h"
+#include "CScheduler.h"
+#include "CRegion.h"
 #include "zutil.h"
 
 static const long s_randomSeed[] = {7, 144};
@@ -35,13 +37,17 @@ CRamCheck::CRamCheck(
     const RAM_REGION ramRegion[],
     const RAM_REGION ramRegionByteOnly[],
     const RAM_REGION ramRegionWriteOnly[],
-    void *bankSwitchContext
+    void *bankSwitchContext,
+    UINT32 addressOffset,
+    ICpu *delayCpu
 ) : m_cpu(cpu),
     m_delayFunction(delayFunction),
+    m_delayCpu((delayCpu != NULL) ? delayCpu : cpu),
     m_ramRegion(ramRegion),
     m_ramRegionByteOnly(ramRegionByteOnly),
     m_ramRegionWriteOnly(ramRegionWriteOnly),
-    m_bankSwitchContext(bankSwitchContext)
+    m_bankSwitchContext(bankSwitchContext),
+    m_addressOffset(addressOffset)
 {
 };
 
@@ -53,10 +59,14 @@ CRamCheck::check(
 )
 {
     PERROR error = errorSuccess;
+    UINT16 count = CRegion::count(m_ramRegion);
+    RAM_REGION ramRegion;
 
-    for (int i = 0 ; m_ramRegion[i].end != 0 ; i++)
+    for (int i = 0 ; CRegion::get(m_ramRegion, i, &ramRegion, m_addressOffset) ; i++)
     {
-        error = check( &m_ramRegion[i] );
+        CScheduler::setProgress(i, count);
+
+        error = check( &ramRegion );
 
         if (FAILED(error))
         {
@@ -82,15 +92,19 @@ CRamCheck::checkChipSelect(
 )
 {
     PERROR error = errorSuccess;
+    UINT16 count = CRegion::count(m_ramRegion);
+    RAM_REGION ramRegion;
 
     //
     // Step 1 - Write all the regions
     //
 
-    for (int i = 0 ; m_ramRegion[i].end != 0 ; i++)
+    for (int i = 0 ; CRegion::get(m_ramRegion, i, &ramRegion, m_addressOffset) ; i++)
     {
-        error = writeRandom( &m_ramRegion[i],
-                             (m_ramRegion[i].start & 0xFFFE) + 1,
+        CScheduler::setProgress(i, count * 2);
+
+        error = writeRandom( &ramRegion,
+                             (ramRegion.start & 0xFFFE) + 1,
                              true );
 
         if (FAILED(error))
@@ -105,10 +119,12 @@ CRamCheck::checkChipSelect(
 
     if (SUCCESS(error))
     {
-        for (int i = 0 ; m_ramRegion[i].end != 0 ; i++)
+        for (int i = 0 ; CRegion::get(m_ramRegion, i, &ramRegion, m_addressOffset) ; i++)
         {
-            error = readVerifyRandom( &m_ramRegion[i],
-                                      (m_ramRegion[i].start & 0xFFFE) + 1,
+            CScheduler::setProgress(count + i, count * 2);
+
+            error = readVerifyRandom( &ramRegion,
+                                      (ramRegion.start & 0xFFFE) + 1,
                                       true );
 
             if (FAILED(error))
@@ -129,10 +145,14 @@ CRamCheck::checkRandomAccess(
 )
 {
     PERROR error = errorSuccess;
+    UINT16 count = CRegion::count(m_ramRegionByteOnly);
+    RAM_REGION ramRegion;
 
-    for (int i = 0 ; m_ramRegionByteOnly[i].end != 0 ; i++)
+    for (int i = 0 ; CRegion::get(m_ramRegionByteOnly, i, &ramRegion, m_addressOffset) ; i++)
     {
-        error = checkRandomAccess( &m_ramRegionByteOnly[i] );
+        CScheduler::setProgress(i, count);
+
+        error = checkRandomAccess( &ramRegion );
 
         if (FAILED(error))
         {
@@ -152,10 +172,11 @@ CRamCheck::write(
 )
 {
     PERROR error = errorSuccess;
+    RAM_REGION ramRegion;
 
-    for (int i = 0 ; m_ramRegion[i].end != 0 ; i++)
+    for (int i = 0 ; CRegion::get(m_ramRegion, i, &ramRegion, m_addressOffset) ; i++)
     {
-        error = write( &m_ramRegion[i] );
+        error = write( &ramRegion );
 
         if (FAILED(error))
         {
@@ -165,9 +186,9 @@ CRamCheck::write(
 
     if (SUCCESS(error))
     {
-        for (int i = 0 ; m_ramRegionWriteOnly[i].end != 0 ; i++)
+        for (int i = 0 ; CRegion::get(m_ramRegionWriteOnly, i, &ramRegion, m_addressOffset) ; i++)
         {
-            error = write( &m_ramRegionWriteOnly[i] );
+            error = write( &ramRegion );
 
             if (FAILED(error))
             {
@@ -189,10 +210,11 @@ CRamCheck::write(
 )
 {
     PERROR error = errorSuccess;
+    RAM_REGION ramRegion;
 
-    for (int i = 0 ; m_ramRegion[i].end != 0 ; i++)
+    for (int i = 0 ; CRegion::get(m_ramRegion, i, &ramRegion, m_addressOffset) ; i++)
     {
-        error = write( &m_ramRegion[i],
+        error = write( &ramRegion,
                        value );
 
         if (FAILED(error))
@@ -203,9 +225,9 @@ CRamCheck::write(
 
     if (SUCCESS(error))
     {
-        for (int i = 0 ; m_ramRegionWriteOnly[i].end != 0 ; i++)
+        for (int i = 0 ; CRegion::get(m_ramRegionWriteOnly, i, &ramRegion, m_addressOffset) ; i++)
         {
-            error = write( &m_ramRegionWriteOnly[i],
+            error = write( &ramRegion,
                            value );
 
             if (FAILED(error))
@@ -226,10 +248,11 @@ CRamCheck::read(
 )
 {
     PERROR error = errorSuccess;
+    RAM_REGION ramRegion;
 
-    for (int i = 0 ; m_ramRegion[i].end != 0 ; i++)
+    for (int i = 0 ; CRegion::get(m_ramRegion, i, &ramRegion, m_addressOffset) ; i++)
     {
-        error = read( &m_ramRegion[i] );
+        error = read( &ramRegion );
 
         if (FAILED(error))
         {
@@ -315,7 +338,7 @@ CRamCheck::writeReadData(
         expData = expData4;
     }
 
-    errorCustom->description = "OK:";
+    stringCopy(errorCustom->description, "OK:");
 
     //
     // Check if we need to perform a bank switch for this region.
@@ -417,6 +440,8 @@ CRamCheck::write(
 
         for (UINT32 address = ramRegion->start ; address <= ramRegion->end ; address += (dataBusWidth * ramRegion->step))
         {
+            YIELD_CHECK_ABORT_BREAK(error);
+
             //
             // The write is a simple data = address.
             //
@@ -462,6 +487,8 @@ CRamCheck::write(
 
         for (UINT32 address = ramRegion->start ; address <= ramRegion->end ; address += (dataBusWidth * ramRegion->step))
         {
+            YIELD_CHECK_ABORT_BREAK(error);
+
             error = m_cpu->memoryWrite(address, value);
 
             if (FAILED(error))
@@ -500,6 +527,8 @@ CRamCheck::read(
 
         for (UINT32 address = ramRegion->start ; address <= ramRegion->end ; address += (dataBusWidth * ramRegion->step))
         {
+            YIELD_CHECK_ABORT_BREAK(error);
+
             UINT16 recData = 0;
 
             error = m_cpu->memoryRead(address, &recData);
@@ -555,6 +584,7 @@ CRamCheck::checkRandomAccess(
 
     UINT32 regionLength    = (ramRegion->end - ramRegion->start) / ramRegion->step;
     UINT32 countLength     = (regionLength * 3) / (dataBusWidth * ramRegion->step);
+    UINT32 laneLength      = regionLength / dataBusWidth;
 
     //
     // This function only works with at least byte-wide memory.
@@ -596,7 +626,9 @@ CRamCheck::checkRandomAccess(
         //
         for (UINT32 count = 0 ; count < countLength ; count++ )
         {
-            UINT32 address = (((UINT32) random(regionLength)) * (dataBusWidth * ramRegion->step)) + ramRegion->start;
+            YIELD_CHECK_ABORT_BREAK(error);
+
+            UINT32 address = (((UINT32) random(laneLength)) * (dataBusWidth * ramRegion->step)) + ramRegion->start;
             UINT16 expData = (((address + cycle) * 3) ^ ((address + cycle) / 5));
             UINT16 recData = 0;
 
@@ -609,7 +641,7 @@ CRamCheck::checkRandomAccess(
             //
             if ((count % (countLength / 4)) == 0)
             {
-                error = m_delayFunction(m_cpu, cycle * 200);
+                error = m_delayFunction(m_delayCpu, cycle * 200);
 
                 if (FAILED(error))
                 {
@@ -693,7 +725,10 @@ CRamCheck::checkRandomAccess(
         // DRAM used on Space Invaders where the RAM fails a few seconds after the
         // data is written.
         //
-        error = m_delayFunction(m_cpu, cycle * 300);
+        if (SUCCESS(error))
+        {
+            error = m_delayFunction(m_delayCpu, cycle * 300);
+        }
 
         if (FAILED(error))
         {
@@ -712,7 +747,9 @@ CRamCheck::checkRandomAccess(
         //
         for (UINT32 count = 0 ; count < countLength ; count++ )
         {
-            UINT32 address = (((UINT32) random(regionLength)) * (dataBusWidth * ramRegion->step)) + ramRegion->start;
+            YIELD_CHECK_ABORT_BREAK(error);
+
+            UINT32 address = (((UINT32) random(laneLength)) * (dataBusWidth * ramRegion->step)) + ramRegion->start;
             UINT16 expData = (((address + cycle) * 3) ^ ((address + cycle) / 5));
             UINT16 recData = 0;
 
@@ -820,8 +857,8 @@ CRamCheck::checkAddress(
         {
             error = errorCustom;
             error->code = ERROR_FAILED;
-            error->description = "A:";
-            error->description += ramRegion->location;
+            stringCopy(error->description, "A:");
+            stringAppend(error->description, ramRegion->location);
             STRING_UINT16_HEX(error->description, ramRegion->end);
             STRING_UINT16_HEX(error->description, subRamRegion.end);
             break;
@@ -837,8 +874,8 @@ CRamCheck::checkAddress(
             {
                 error = errorCustom;
                 error->code = ERROR_FAILED;
-                error->description = "E:";
-                error->description += ramRegion->location;
+                stringCopy(error->description, "E:");
+                stringAppend(error->description, ramRegion->location);
                 STRING_UINT16_HEX(error->description, ramRegion->start);
                 STRING_UINT16_HEX(error->description, (1UL << ((shift - 1) + dataBusWidthAndStepShift)));
             }
@@ -881,6 +918,8 @@ CRamCheck::writeRandom(
         randomSeed(seed);
         for (UINT32 address = ramRegion->start ; address <= ramRegion->end ; address += (dataBusWidth * ramRegion->step))
         {
+            YIELD_CHECK_ABORT_BREAK(error);
+
             UINT16 data = (UINT16) random(s_randomSize);
             data = (invert) ? ~data : data;
 
@@ -939,6 +978,8 @@ CRamCheck::readVerifyRandom(
         randomSeed(seed);
         for (UINT32 address = ramRegion->start ; address <= ramRegion->end ; address += (dataBusWidth * ramRegion->step))
         {
+            YIELD_CHECK_ABORT_BREAK(error);
+
             UINT16 expData = (UINT16) random(s_randomSize);
             expData = (invert) ? ~expData : expData;
             UINT16 recData = 0;
@@ -984,3 +1025,4 @@ CRamCheck::readVerifyRandom(
     return error;
 }
 
+
@@ -34,13 +34,23 @@ class CRamCheck
 {
     public:
 
+        //
+        // The region tables are in PROGMEM. The address offset is added to
+        // all the regions to allow the whole address space to be moved.
+        //
+        // The delay function is given delayCpu (cpu if none) as its context.
+        // The game delay functions cast it to their concrete driver, so it
+        // must be the driver itself rather than e.g. the trace wrapper.
+        //
         CRamCheck(
             ICpu  *cpu,
             const DelayFunctionCallback delayFunction,
             const RAM_REGION ramRegion[],
             const RAM_REGION ramRegionByteOnly[],
             const RAM_REGION ramRegionWriteOnly[],
-            void *bankSwitchContext
+            void *bankSwitchContext,
+            UINT32 addressOffset = 0,
+            ICpu  *delayCpu = NULL
         );
 
         PERROR
@@ -128,11 +138,13 @@ class CRamCheck
 
         ICpu                        *m_cpu;
         const DelayFunctionCallback  m_delayFunction;
+        ICpu                        *m_delayCpu;
 
         const RAM_REGION            *m_ramRegion;
         const RAM_REGION            *m_ramRegionByteOnly;
         const RAM_REGION            *m_ramRegionWriteOnly;
         void                        *m_bankSwitchContext;
+        UINT32                       m_addressOffset;
 };
 
 #endif
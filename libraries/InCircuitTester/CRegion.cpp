@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CRegion.h"
+
+
+bool
+CRegion::get(
+    const ROM_REGION *romRegion,
+    UINT16           index,
+    ROM_REGION       *region
+)
+{
+    memcpy_P(region, &romRegion[index], sizeof(*region));
+
+    return (region->length != 0);
+}
+
+
+bool
+CRegion::get(
+    const RAM_REGION *ramRegion,
+    UINT16           index,
+    RAM_REGION       *region,
+    UINT32           addressOffset
+)
+{
+    memcpy_P(region, &ramRegion[index], sizeof(*region));
+
+    if (region->end == 0)
+    {
+        return false;
+    }
+
+    region->start += addressOffset;
+    region->end   += addressOffset;
+
+    return true;
+}
+
+
+bool
+CRegion::get(
+    const INPUT_REGION *inputRegion,
+    UINT16             index,
+    INPUT_REGION       *region,
+    UINT32             addressOffset
+)
+{
+    memcpy_P(region, &inputRegion[index], sizeof(*region));
+
+    if (region->mask == 0)
+    {
+        return false;
+    }
+
+    region->address += addressOffset;
+
+    return true;
+}
+
+
+bool
+CRegion::get(
+    const OUTPUT_REGION *outputRegion,
+    UINT16              index,
+    OUTPUT_REGION       *region,
+    UINT32              addressOffset
+)
+{
+    memcpy_P(region, &outputRegion[index], sizeof(*region));
+
+    if (region->activeMask == 0)
+    {
+        return false;
+    }
+
+    region->address += addressOffset;
+
+    return true;
+}
+
+
+bool
+CRegion::get(
+    const CUSTOM_FUNCTION *customFunction,
+    UINT16                index,
+    CUSTOM_FUNCTION       *function
+)
+{
+    memcpy_P(function, &customFunction[index], sizeof(*function));
+
+    return (function->function != NULL);
+}
+
+
+bool
+CRegion::get(
+    const SELECTOR *selector,
+    UINT16         index,
+    SELECTOR       *selection
+)
+{
+    memcpy_P(selection, &selector[index], sizeof(*selection));
+
+    return (selection->function != NULL);
+}
+
+
+//
+// The counts only read the field used as the end of list marker.
+//
+
+UINT16
+CRegion::count(
+    const ROM_REGION *romRegion
+)
+{
+    UINT16 count = 0;
+
+    for ( ; pgm_read_dword_near(&romRegion[count].length) != 0 ; count++) {}
+
+    return count;
+}
+
+
+UINT16
+CRegion::count(
+    const RAM_REGION *ramRegion
+)
+{
+    UINT16 count = 0;
+
+    for ( ; pgm_read_dword_near(&ramRegion[count].end) != 0 ; count++) {}
+
+    return count;
+}
+
+
+UINT16
+CRegion::count(
+    const INPUT_REGION *inputRegion
+)
+{
+    UINT16 count = 0;
+
+    for ( ; pgm_read_word_near(&inputRegion[count].mask) != 0 ; count++) {}
+
+    return count;
+}
+
+
+UINT16
+CRegion::count(
+    const OUTPUT_REGION *outputRegion
+)
+{
+    UINT16 count = 0;
+
+    for ( ; pgm_read_word_near(&outputRegion[count].activeMask) != 0 ; count++) {}
+
+    return count;
+}
+
+
+UINT16
+CRegion::count(
+    const CUSTOM_FUNCTION *customFunction
+)
+{
+    UINT16 count = 0;
+
+    for ( ; pgm_read_ptr_near(&customFunction[count].function) != NULL ; count++) {}
+
+    return count;
+}
+
+
+UINT16
+CRegion::count(
+    const SELECTOR *selector
+)
+{
+    UINT16 count = 0;
+
+    for ( ; pgm_read_ptr_near(&selector[count].function) != NULL ; count++) {}
+
+    return count;
+}
+
@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CRegion_h
+#define CRegion_h
+
+#include "Arduino.h"
+#include "Types.h"
+
+#include <avr/pgmspace.h>
+
+//
+// Read-only access to the region & selector tables that are defined in PROGMEM.
+// This is a static class.
+//
+// Rather than the whole table being copied into SRAM when a game is selected,
+// one entry at a time is copied into a region supplied by the caller. This
+// is the SRAM copy of the active region for the test to use, so the hot fields
+// are only read from flash once per region rather than per bus cycle.
+//
+// An address offset can be applied to RAM & IO regions to allow the whole
+// address space of a game to be moved.
+//
+class CRegion
+{
+    public:
+
+        //
+        // Copy an entry of the table into the supplied region.
+        // Returns false if the entry is the end of list marker.
+        //
+
+        static bool get(
+            const ROM_REGION *romRegion,
+            UINT16           index,
+            ROM_REGION       *region
+        );
+
+        static bool get(
+            const RAM_REGION *ramRegion,
+            UINT16           index,
+            RAM_REGION       *region,
+            UINT32           addressOffset = 0
+        );
+
+        static bool get(
+            const INPUT_REGION *inputRegion,
+            UINT16             index,
+            INPUT_REGION       *region,
+            UINT32             addressOffset = 0
+        );
+
+        static bool get(
+            const OUTPUT_REGION *outputRegion,
+            UINT16              index,
+            OUTPUT_REGION       *region,
+            UINT32              addressOffset = 0
+        );
+
+        static bool get(
+            const CUSTOM_FUNCTION *customFunction,
+            UINT16                index,
+            CUSTOM_FUNCTION       *function
+        );
+
+        static bool get(
+            const SELECTOR *selector,
+            UINT16         index,
+            SELECTOR       *selection
+        );
+
+        //
+        // The number of entries in the table, excluding the end of list marker.
+        //
+
+        static UINT16 count(
+            const ROM_REGION *romRegion
+        );
+
+        static UINT16 count(
+            const RAM_REGION *ramRegion
+        );
+
+        static UINT16 count(
+            const INPUT_REGION *inputRegion
+        );
+
+        static UINT16 count(
+            const OUTPUT_REGION *outputRegion
+        );
+
+        static UINT16 count(
+            const CUSTOM_FUNCTION *customFunction
+        );
+
+        static UINT16 count(
+            const SELECTOR *selector
+        );
+
+        //
+        // Read an entry of a ROM data2n table that is in PROGMEM.
+        //
+        static inline UINT16 data2n(
+            const UINT16 *data2n,
+            UINT32       shift
+        )
+        {
+            return pgm_read_word_near(&data2n[shift]);
+        }
+};
+
+#endif
+
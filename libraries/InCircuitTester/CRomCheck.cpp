@@ -23,16 +23,20 @@
 // EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //
 #include "CRomCheck.h"
+#include "CScheduler.h"
+#include "CRegion.h"
 #include "zutil.h"
 
 
 CRomCheck::CRomCheck(
     ICpu *cpu,
     const ROM_REGION romRegion[],
-    void *bankSwitchContext
+    void *bankSwitchContext,
+    bool data2nInProgMem
 ) : m_cpu(cpu),
     m_romRegion(romRegion),
-    m_bankSwitchContext(bankSwitchContext)
+    m_bankSwitchContext(bankSwitchContext),
+    m_data2nInProgMem(data2nInProgMem)
 {
 };
 
@@ -45,10 +49,14 @@ CRomCheck::check(
 )
 {
     PERROR error = errorSuccess;
+    UINT16 count = CRegion::count(m_romRegion);
+    ROM_REGION romRegion;
 
-    for (int index = 0 ; m_romRegion[index].length != 0 ; index++)
+    for (int index = 0 ; CRegion::get(m_romRegion, index, &romRegion) ; index++)
     {
-        error = check( &m_romRegion[index] );
+        CScheduler::setProgress(index, count);
+
+        error = check( &romRegion );
 
         if (FAILED(error))
         {
@@ -68,10 +76,11 @@ CRomCheck::read(
 )
 {
     PERROR error = errorSuccess;
+    ROM_REGION romRegion;
 
-    for (int index = 0 ; m_romRegion[index].length != 0 ; index++)
+    for (int index = 0 ; CRegion::get(m_romRegion, index, &romRegion) ; index++)
     {
-        error = read( &m_romRegion[index] );
+        error = read( &romRegion );
 
         if (FAILED(error))
         {
@@ -112,7 +121,8 @@ CRomCheck::checkData2n(
         for (UINT32 shift = 0 ; (1UL << shift) < romRegion->length ; shift++)
         {
             UINT32 address = romRegion->start + (1UL << (shift + dataBusWidthShift));
-            UINT16 expData = romRegion->data2n[shift];
+            UINT16 expData = m_data2nInProgMem ? CRegion::data2n(romRegion->data2n, shift) :
+                                                 romRegion->data2n[shift];
             UINT16 recData = 0;
 
             error = m_cpu->memoryRead(address, &recData);
@@ -176,6 +186,8 @@ CRomCheck::calculateCrc(
              address < (romRegion->start + (romRegion->length * dataBusWidth));
              address += dataBusWidth)
         {
+            YIELD_CHECK_ABORT_BREAK(error);
+
             error = m_cpu->memoryRead(address, &data);
 
             if (FAILED(error))
@@ -223,7 +235,7 @@ CRomCheck::readData(
     PERROR error = errorSuccess;
     UINT16 data[4] = {0};
 
-    errorCustom->description = "OK:";
+    stringCopy(errorCustom->description, "OK:");
 
     //
     // Check if we need to perform a bank switch for this region.
@@ -304,8 +316,8 @@ CRomCheck::checkCrc(
             error = errorCustom;
 
             error->code = ERROR_FAILED;
-            error->description = "E:";
-            error->description += romRegion->location;
+            stringCopy(error->description, "E:");
+            stringAppend(error->description, romRegion->location);
             STRING_UINT32_HEX(error->description, crc);
         }
     }
@@ -342,6 +354,8 @@ CRomCheck::read(
              address < (romRegion->start + (romRegion->length * dataBusWidth)) ;
              address += dataBusWidth)
         {
+            YIELD_CHECK_ABORT_BREAK(error);
+
             UINT16 recData = 0;
 
             error = m_cpu->memoryRead(address, &recData);
@@ -34,10 +34,15 @@ class CRomCheck
 {
     public:
 
+        //
+        // The region table is in PROGMEM. The data2n samples the regions point
+        // to are also in PROGMEM unless the game is using the legacy SRAM data2n.
+        //
         CRomCheck(
             ICpu *cpu,
             const ROM_REGION romRegion[],
-            void *bankSwitchContext
+            void *bankSwitchContext,
+            bool data2nInProgMem = false
         );
 
         //
@@ -92,6 +97,7 @@ class CRomCheck
         ICpu             *m_cpu;
         const ROM_REGION *m_romRegion;
         void             *m_bankSwitchContext;
+        bool              m_data2nInProgMem;
 
 };
 
@@ -0,0 +1,222 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CScheduler.h"
+#include <DFR_Key.h>
+
+//
+// The maximum number of tasks & keys that can be queued.
+//
+static const UINT8 s_maxTasks = 4;
+static const UINT8 s_maxKeys  = 8;
+
+typedef struct _TASK {
+
+    CScheduler::TaskCallback  callback;
+    void                     *context;
+    UINT16                    periodInMs;
+    UINT16                    lastRun;
+
+} TASK, *PTASK;
+
+static TASK   s_task[s_maxTasks];
+static UINT8  s_numTasks;
+
+static INT8   s_key[s_maxKeys];
+static UINT8  s_keyHead;
+static UINT8  s_keyTail;
+
+static UINT16 s_now;
+static bool   s_running;
+
+static UINT8  s_progress = CScheduler::c_noProgress;
+
+volatile UINT8 CScheduler::s_tick;
+UINT8          CScheduler::s_lastTick;
+bool           CScheduler::s_abort;
+
+//
+// Timer 0 is already running at ~1KHz for millis() so the compare A interrupt
+// is used for the tick rather than taking up another timer. The handler is
+// kept to a single increment.
+//
+ISR(TIMER0_COMPA_vect)
+{
+    CScheduler::s_tick++;
+}
+
+
+void
+CScheduler::begin(
+)
+{
+    OCR0A   = 0x80;
+    TIMSK0 |= _BV(OCIE0A);
+}
+
+
+bool
+CScheduler::addTask(
+    TaskCallback  callback,
+    void         *context,
+    UINT16        periodInMs
+)
+{
+    if (s_numTasks >= s_maxTasks)
+    {
+        return false;
+    }
+
+    s_task[s_numTasks].callback   = callback;
+    s_task[s_numTasks].context    = context;
+    s_task[s_numTasks].periodInMs = periodInMs;
+    s_task[s_numTasks].lastRun    = s_now;
+
+    s_numTasks++;
+
+    return true;
+}
+
+
+void
+CScheduler::putKey(
+    int key
+)
+{
+    UINT8 next = (s_keyHead + 1) % s_maxKeys;
+
+    // When full the newest key is dropped.
+    if (next != s_keyTail)
+    {
+        s_key[s_keyHead] = (INT8) key;
+        s_keyHead = next;
+    }
+}
+
+
+int
+CScheduler::getKey(
+)
+{
+    int key = SAMPLE_WAIT;
+
+    if (s_keyTail != s_keyHead)
+    {
+        key = s_key[s_keyTail];
+        s_keyTail = (s_keyTail + 1) % s_maxKeys;
+    }
+
+    return key;
+}
+
+
+void
+CScheduler::requestAbort(
+)
+{
+    s_abort = true;
+}
+
+
+void
+CScheduler::clearAbort(
+)
+{
+    s_abort = false;
+}
+
+
+//
+// This is only called at region & block boundaries so the division
+// here doesn't slow down the test.
+//
+void
+CScheduler::setProgress(
+    UINT16 done,
+    UINT16 total
+)
+{
+    if (total != 0)
+    {
+        s_progress = (UINT8) (((UINT32) done * 100) / total);
+    }
+}
+
+
+void
+CScheduler::clearProgress(
+)
+{
+    s_progress = c_noProgress;
+}
+
+
+UINT8
+CScheduler::progress(
+)
+{
+    return s_progress;
+}
+
+
+UINT16
+CScheduler::now(
+)
+{
+    return s_now;
+}
+
+
+void
+CScheduler::run(
+)
+{
+    UINT8 tick = s_tick;
+
+    s_now     += (UINT8) (tick - s_lastTick);
+    s_lastTick = tick;
+
+    //
+    // A task may end up calling yield itself (e.g. via delay) so
+    // guard against running the tasks recursively.
+    //
+    if (s_running)
+    {
+        return;
+    }
+
+    s_running = true;
+
+    for (UINT8 i = 0 ; i < s_numTasks ; i++)
+    {
+        if ((UINT16) (s_now - s_task[i].lastRun) >= s_task[i].periodInMs)
+        {
+            s_task[i].lastRun = s_now;
+            s_task[i].callback(s_task[i].context);
+        }
+    }
+
+    s_running = false;
+}
+
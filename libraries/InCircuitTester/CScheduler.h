@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CScheduler_h
+#define CScheduler_h
+
+#include "Arduino.h"
+#include "Types.h"
+#include "Error.h"
+
+//
+// A tiny cooperative scheduler so that the heartbeat LED, keypad scan & LCD
+// keep running while a long test is in progress. This is a static class.
+//
+// A timer interrupt only advances a tick count. The tasks themselves are run
+// from "yield" which the test loops call between bus cycles, so no task ever
+// preempts a bus cycle or races the bus drivers for the shared port registers.
+//
+// NOTE: Tasks must not use random() since the RAM tests rely on the sequence.
+//
+class CScheduler
+{
+    public:
+
+        //
+        // The callback made when a task is due.
+        //
+        typedef void (*TaskCallback)(void *context);
+
+        //
+        // Start the timer tick.
+        //
+        static void begin(
+        );
+
+        //
+        // Add a task to be run every "periodInMs" milliseconds (approximately).
+        // Returns false if the task table is full.
+        //
+        static bool addTask(
+            TaskCallback  callback,
+            void         *context,
+            UINT16        periodInMs
+        );
+
+        //
+        // The yield hook. This is cheap enough to call for every bus cycle
+        // as it only runs the tasks once per tick.
+        //
+        static inline void yield(
+        )
+        {
+            if (s_tick != s_lastTick)
+            {
+                run();
+            }
+        }
+
+        //
+        // Queue of keys scanned by the keypad task.
+        // getKey returns SAMPLE_WAIT if the queue is empty.
+        //
+        static void putKey(
+            int key
+        );
+
+        static int getKey(
+        );
+
+        //
+        // Abort of the running test, requested by the keypad or serial task.
+        // Tests check this at region & block boundaries and return errorAborted.
+        //
+        static void requestAbort(
+        );
+
+        static void clearAbort(
+        );
+
+        static inline bool aborted(
+        )
+        {
+            return s_abort;
+        }
+
+        //
+        // Progress of the running test in percent, displayed by the busy task.
+        // Set to c_noProgress when the test doesn't report any.
+        //
+        static const UINT8 c_noProgress = 0xFF;
+
+        static void setProgress(
+            UINT16 done,
+            UINT16 total
+        );
+
+        static void clearProgress(
+        );
+
+        static UINT8 progress(
+        );
+
+        //
+        // The current tick count in milliseconds (approximately).
+        // Only advances whilst yield is being called.
+        //
+        static UINT16 now(
+        );
+
+        //
+        // Updated by the timer interrupt.
+        //
+        static volatile UINT8 s_tick;
+
+    private:
+
+        static void run(
+        );
+
+        static UINT8 s_lastTick;
+
+        static bool  s_abort;
+
+};
+
+//
+// Macro to run the yield hook and break out of the enclosing loop
+// with an error if an abort has been requested.
+//
+#define YIELD_CHECK_ABORT_BREAK(error)                                      \
+    {                                                                       \
+        CScheduler::yield();                                                \
+                                                                            \
+        if (CScheduler::aborted())                                          \
+        {                                                                   \
+            error = errorAborted;                                           \
+            break;                                                          \
+        }                                                                   \
+    }
+
+#endif
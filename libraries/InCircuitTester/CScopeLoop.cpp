@@ -0,0 +1,224 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CScopeLoop.h"
+#include "CScheduler.h"
+#include "PinMap.h"
+
+//
+// Scope trigger output on J14 AUX pin 2. Pin 1 is the capture input and
+// pin 8 is the master clock of the clock master CPUs.
+//
+static const CONNECTION s_Trigger_o = { 2, "Trigger" };
+
+
+CScopeLoop::CScopeLoop(
+    ICpu *cpu,
+    void *bankSwitchContext
+) : m_cpu(cpu),
+    m_bankSwitchContext(bankSwitchContext),
+    m_pinTrigger(g_pinMap8Aux, &s_Trigger_o)
+{
+};
+
+
+PERROR
+CScopeLoop::run(
+    Mode              mode,
+    const RAM_REGION *ramRegion,
+    UINT16            data
+)
+{
+    UINT8  dataBusWidth = m_cpu->dataBusWidth(ramRegion->start);
+    UINT16 toggleBit    = ramRegion->mask & (~ramRegion->mask + 1);
+
+    return loop( mode,
+                 ramRegion->bankSwitch,
+                 ramRegion->start,
+                 ramRegion->end,
+                 dataBusWidth * ramRegion->step,
+                 data & ramRegion->mask,
+                 toggleBit );
+}
+
+
+PERROR
+CScopeLoop::run(
+    Mode              mode,
+    const ROM_REGION *romRegion
+)
+{
+    UINT8 dataBusWidth = m_cpu->dataBusWidth(romRegion->start);
+
+    return loop( mode,
+                 romRegion->bankSwitch,
+                 romRegion->start,
+                 romRegion->start + (romRegion->length * dataBusWidth) - 1,
+                 dataBusWidth,
+                 0,
+                 1 );
+}
+
+
+//
+// The bursts are run with interrupts disabled to keep the timer & serial
+// interrupts from stretching the loop. The drivers restore the caller's
+// interrupt state at the end of each bus cycle rather than enabling them,
+// so they stay masked for the whole burst.
+//
+PERROR
+CScopeLoop::loop(
+    Mode               mode,
+    BankSwitchCallback bankSwitch,
+    UINT32             start,
+    UINT32             end,
+    UINT32             addressStep,
+    UINT16             data,
+    UINT16             toggleBit
+)
+{
+    PERROR error = errorSuccess;
+    UINT32 address = start;
+    UINT32 walk = 0;
+    UINT16 recData;
+
+    if (bankSwitch != NO_BANK_SWITCH)
+    {
+        error = bankSwitch( m_bankSwitchContext );
+    }
+
+    m_pinTrigger.pinMode(OUTPUT);
+    m_pinTrigger.digitalWriteLOW();
+
+    while (SUCCESS(error))
+    {
+        noInterrupts();
+
+        for (UINT16 iteration = 0 ; iteration < c_burst ; iteration++)
+        {
+            switch (mode)
+            {
+                case READ_LOOP :
+                {
+                    m_pinTrigger.digitalWriteHIGH();
+                    m_pinTrigger.digitalWriteLOW();
+
+                    error = m_cpu->memoryRead(start, &recData);
+                    break;
+                }
+
+                case WRITE_LOOP :
+                {
+                    m_pinTrigger.digitalWriteHIGH();
+                    m_pinTrigger.digitalWriteLOW();
+
+                    error = m_cpu->memoryWrite(start, data);
+                    break;
+                }
+
+                case ADDRESS_RAMP :
+                {
+                    if (address == start)
+                    {
+                        m_pinTrigger.digitalWriteHIGH();
+                        m_pinTrigger.digitalWriteLOW();
+                    }
+
+                    error = m_cpu->memoryRead(address, &recData);
+
+                    address += addressStep;
+
+                    if (address > end)
+                    {
+                        address = start;
+                    }
+                    break;
+                }
+
+                case DATA_TOGGLE :
+                {
+                    m_pinTrigger.digitalWriteHIGH();
+                    m_pinTrigger.digitalWriteLOW();
+
+                    error = m_cpu->memoryWrite(start, toggleBit);
+
+                    if (SUCCESS(error))
+                    {
+                        error = m_cpu->memoryWrite(start, 0);
+                    }
+                    break;
+                }
+
+                case ADDRESS_WALK :
+                {
+                    //
+                    // The walk starts with the base address itself so that
+                    // every address line is seen changing from a known level.
+                    // The walk bit is toggled rather than added so that only
+                    // that one line changes, whatever the base address is.
+                    //
+                    if (walk == 0)
+                    {
+                        m_pinTrigger.digitalWriteHIGH();
+                        m_pinTrigger.digitalWriteLOW();
+                    }
+
+                    error = m_cpu->memoryRead(start ^ walk, &recData);
+
+                    walk = (walk == 0) ? addressStep : (walk << 1);
+
+                    if (walk > (end - start))
+                    {
+                        walk = 0;
+                    }
+                    break;
+                }
+
+                default :
+                {
+                    error = errorNotImplemented;
+                    break;
+                }
+            }
+
+            if (FAILED(error))
+            {
+                break;
+            }
+        }
+
+        interrupts();
+
+        if (FAILED(error))
+        {
+            break;
+        }
+
+        YIELD_CHECK_ABORT_BREAK(error);
+    }
+
+    m_pinTrigger.pinMode(INPUT);
+
+    return error;
+}
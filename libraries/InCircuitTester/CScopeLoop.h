@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CScopeLoop_h
+#define CScopeLoop_h
+
+#include "Arduino.h"
+#include "Types.h"
+#include "ICpu.h"
+#include "CFastPin.h"
+
+//
+// Repeats a single bus stimulus, in the style of the Fluke 9010A loop modes,
+// so that a failing board can be probed with a scope. The loop runs until
+// it's aborted from the keypad or a bus error is returned by the CPU.
+//
+// J14 AUX pin 2 is pulsed high at the start of every iteration to be used
+// as the scope trigger. For the ramp & walk modes an iteration is a whole
+// sweep of the region so the trace lines up with the first address.
+//
+class CScopeLoop
+{
+    public:
+
+        typedef enum {
+            READ_LOOP,      // Read the first address of the region.
+            WRITE_LOOP,     // Write the data to the first address of the region.
+            ADDRESS_RAMP,   // Read each address of the region in turn.
+            DATA_TOGGLE,    // Write the lowest mask bit set then clear.
+            ADDRESS_WALK,   // Read the first address with a walking bit toggled.
+            MODE_COUNT
+        } Mode;
+
+        CScopeLoop(
+            ICpu *cpu,
+            void *bankSwitchContext
+        );
+
+        //
+        // Loop the mode over the RAM region. The data is only used by the
+        // write loop and is masked by the region mask.
+        //
+        PERROR
+        run(
+            Mode              mode,
+            const RAM_REGION *ramRegion,
+            UINT16            data
+        );
+
+        //
+        // Loop the mode over the ROM region using the full data bus.
+        //
+        PERROR
+        run(
+            Mode              mode,
+            const ROM_REGION *romRegion
+        );
+
+    private:
+
+        PERROR
+        loop(
+            Mode               mode,
+            BankSwitchCallback bankSwitch,
+            UINT32             start,
+            UINT32             end,
+            UINT32             addressStep,
+            UINT16             data,
+            UINT16             toggleBit
+        );
+
+        //
+        // Number of iterations run with interrupts disabled before
+        // the scheduler is given a chance to run.
+        //
+        static const UINT16 c_burst = 256;
+
+        ICpu     *m_cpu;
+        void     *m_bankSwitchContext;
+        CFastPin  m_pinTrigger;
+
+};
+
+#endif
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CTestTiming.h"
+#include <DFR_Key.h>
+
+#if TEST_TIMING
+
+//
+// The best duration is kept for this many different tests.
+//
+static const UINT8 s_maxTests = 24;
+
+typedef struct _TEST_BEST {
+
+    const void *id;
+    UINT8       selection;
+    UINT32      us;
+
+} TEST_BEST, *PTEST_BEST;
+
+static TEST_BEST s_best[s_maxTests];
+static UINT8     s_numBest;
+
+static UINT32    s_startUs;
+static UINT32    s_startBusCycles;
+
+static bool      s_valid;
+static UINT32    s_lastUs;
+static UINT32    s_bestUs;
+static UINT32    s_lastBusCycles;
+
+
+void
+CTestTiming::reset(
+)
+{
+    s_numBest = 0;
+    s_valid   = false;
+}
+
+
+void
+CTestTiming::clear(
+)
+{
+    s_valid = false;
+}
+
+
+void
+CTestTiming::start(
+    UINT32 busCycles
+)
+{
+    s_startBusCycles = busCycles;
+    s_startUs        = micros();
+}
+
+
+void
+CTestTiming::stop(
+    const void *id,
+    int        selection,
+    int        key,
+    UINT32     busCycles
+)
+{
+    UINT32 us = micros() - s_startUs;
+    PTEST_BEST best = NULL;
+
+    if (key != SELECT_KEY)
+    {
+        return;
+    }
+
+    s_lastUs        = us;
+    s_lastBusCycles = busCycles - s_startBusCycles;
+    s_bestUs        = us;
+    s_valid         = true;
+
+    for (UINT8 i = 0 ; i < s_numBest ; i++)
+    {
+        if ((s_best[i].id == id) && (s_best[i].selection == (UINT8) selection))
+        {
+            best = &s_best[i];
+            break;
+        }
+    }
+
+    if ((best == NULL) && (s_numBest < s_maxTests))
+    {
+        best = &s_best[s_numBest++];
+        best->id        = id;
+        best->selection = (UINT8) selection;
+        best->us        = us;
+    }
+
+    if (best != NULL)
+    {
+        if (us < best->us)
+        {
+            best->us = us;
+        }
+
+        s_bestUs = best->us;
+    }
+}
+
+
+bool
+CTestTiming::valid(
+)
+{
+    return s_valid;
+}
+
+
+UINT32
+CTestTiming::lastUs(
+)
+{
+    return s_lastUs;
+}
+
+
+UINT32
+CTestTiming::bestUs(
+)
+{
+    return s_bestUs;
+}
+
+
+UINT32
+CTestTiming::lastBusCycles(
+)
+{
+    return s_lastBusCycles;
+}
+
+#endif
+
@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CTestTiming_h
+#define CTestTiming_h
+
+#include "Arduino.h"
+#include "Types.h"
+
+//
+// Set to 0 to compile out the per-test timing. Everything below then expands
+// to nothing.
+//
+#ifndef TEST_TIMING
+#define TEST_TIMING 1
+#endif
+
+#if TEST_TIMING
+
+//
+// Timing of the tests run through CGameCallback. This is a static class.
+//
+// Each SELECT of a test records the duration (micros) and the number of bus
+// cycles the CPU driver made, plus the best duration seen for that test since
+// the game was selected. The bus cycles are the difference in the CPU's own
+// bus stats counters (see ICpu.h) so there's no separate count to keep.
+//
+class CTestTiming
+{
+    public:
+
+        //
+        // Forget the best durations, e.g. on a game change.
+        //
+        static void reset(
+        );
+
+        //
+        // Forget the last result, so that valid() reports if a test was timed.
+        //
+        static void clear(
+        );
+
+        static void start(
+            UINT32 busCycles
+        );
+
+        //
+        // "id" & "selection" identify the test for the best duration, the
+        // latter being the region or custom function picked in a sub menu.
+        // Only SELECT is recorded since the sub menu key moves aren't tests.
+        //
+        static void stop(
+            const void *id,
+            int        selection,
+            int        key,
+            UINT32     busCycles
+        );
+
+        static bool valid(
+        );
+
+        static UINT32 lastUs(
+        );
+
+        static UINT32 bestUs(
+        );
+
+        static UINT32 lastBusCycles(
+        );
+};
+
+#endif
+
+#endif
+
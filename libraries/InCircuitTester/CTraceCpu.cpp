@@ -0,0 +1,205 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CTraceCpu.h"
+
+TRACE_ENTRY CTraceCpu::s_ring[CTraceCpu::c_depth];
+UINT8       CTraceCpu::s_next;
+UINT8       CTraceCpu::s_count;
+
+
+CTraceCpu::CTraceCpu(
+    ICpu *cpu
+) : m_cpu(cpu)
+{
+};
+
+
+ICpu *
+CTraceCpu::cpu(
+)
+{
+    return m_cpu;
+}
+
+
+void
+CTraceCpu::clear(
+)
+{
+    s_next  = 0;
+    s_count = 0;
+}
+
+
+UINT8
+CTraceCpu::count(
+)
+{
+    return s_count;
+}
+
+
+bool
+CTraceCpu::get(
+    UINT8        index,
+    TRACE_ENTRY *entry
+)
+{
+    if (index >= s_count)
+    {
+        return false;
+    }
+
+    // s_next is one past the most recent entry.
+    *entry = s_ring[(UINT8) (s_next + c_depth - 1 - index) % c_depth];
+
+    return true;
+}
+
+
+//
+// Kept short since it's on every access, no more than a few stores.
+//
+void
+CTraceCpu::record(
+    UINT32 address,
+    UINT16 data,
+    UINT8  flags
+)
+{
+    TRACE_ENTRY *entry = &s_ring[s_next];
+
+    entry->address = address;
+    entry->data    = data;
+    entry->flags   = flags;
+
+    if (++s_next == c_depth)
+    {
+        s_next = 0;
+    }
+
+    if (s_count < c_depth)
+    {
+        s_count++;
+    }
+}
+
+
+PERROR
+CTraceCpu::idle(
+)
+{
+    return m_cpu->idle();
+}
+
+
+PERROR
+CTraceCpu::check(
+)
+{
+    return m_cpu->check();
+}
+
+
+UINT8
+CTraceCpu::dataBusWidth(
+    UINT32 address
+)
+{
+    return m_cpu->dataBusWidth(address);
+}
+
+
+UINT8
+CTraceCpu::dataAccessWidth(
+    UINT32 address
+)
+{
+    return m_cpu->dataAccessWidth(address);
+}
+
+
+PERROR
+CTraceCpu::memoryRead(
+    UINT32 address,
+    UINT16 *data
+)
+{
+    PERROR error = m_cpu->memoryRead(address, data);
+
+    record(address, *data, FAILED(error) ? TRACE_FLAG_FAILED : 0);
+
+    return error;
+}
+
+
+PERROR
+CTraceCpu::memoryWrite(
+    UINT32 address,
+    UINT16 data
+)
+{
+    PERROR error = m_cpu->memoryWrite(address, data);
+
+    record(address, data, TRACE_FLAG_WRITE | (FAILED(error) ? TRACE_FLAG_FAILED : 0));
+
+    return error;
+}
+
+
+PERROR
+CTraceCpu::waitForInterrupt(
+    Interrupt interrupt,
+    bool      active,
+    UINT32    timeoutInMsOrClockPulses
+)
+{
+    return m_cpu->waitForInterrupt(interrupt, active, timeoutInMsOrClockPulses);
+}
+
+
+PERROR
+CTraceCpu::acknowledgeInterrupt(
+    UINT16 *response
+)
+{
+    return m_cpu->acknowledgeInterrupt(response);
+}
+
+
+const BUS_STATS *
+CTraceCpu::busStats(
+)
+{
+    return m_cpu->busStats();
+}
+
+
+void
+CTraceCpu::clearBusStats(
+)
+{
+    m_cpu->clearBusStats();
+}
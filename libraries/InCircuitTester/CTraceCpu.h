@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CTraceCpu_h
+#define CTraceCpu_h
+
+#include "Arduino.h"
+#include "ICpu.h"
+
+//
+// A trace entry for one bus access.
+//
+typedef struct _TRACE_ENTRY {
+
+    UINT32 address;
+    UINT16 data;
+    UINT8  flags;
+
+} TRACE_ENTRY, *PTRACE_ENTRY;
+
+#define TRACE_FLAG_WRITE  0x01
+#define TRACE_FLAG_FAILED 0x02
+
+//
+// Decorator that passes everything through to the wrapped CPU, in the same
+// way C6821ProxyCpu wraps the CPU that drives the 6821, and records each
+// memory read & write into a ring buffer.
+//
+// The ring is static (there is only ever one trace in progress) and holds the
+// most recent c_depth accesses, so after a test fails the accesses leading up
+// to the failure are there to be looked at.
+//
+class CTraceCpu : public ICpu
+{
+    public:
+
+        //
+        // The number of accesses kept.
+        //
+        static const UINT8 c_depth = 32;
+
+        CTraceCpu(
+            ICpu *cpu
+        );
+
+        //
+        // The CPU that is being traced.
+        //
+        ICpu *cpu(
+        );
+
+        //
+        // Empty the ring ready for the next test.
+        //
+        static void clear(
+        );
+
+        //
+        // The number of entries in the ring, up to c_depth.
+        //
+        static UINT8 count(
+        );
+
+        //
+        // Get an entry, index 0 is the most recent access.
+        //
+        static bool get(
+            UINT8        index,
+            TRACE_ENTRY *entry
+        );
+
+        //
+        // ICpu Interface
+        //
+
+        virtual
+        PERROR
+        idle(
+        );
+
+        virtual
+        PERROR
+        check(
+        );
+
+        virtual
+        UINT8
+        dataBusWidth(
+            UINT32 address
+        );
+
+        virtual
+        UINT8
+        dataAccessWidth(
+            UINT32 address
+        );
+
+        virtual
+        PERROR
+        memoryRead(
+            UINT32 address,
+            UINT16 *data
+        );
+
+        virtual
+        PERROR
+        memoryWrite(
+            UINT32 address,
+            UINT16 data
+        );
+
+        virtual
+        PERROR
+        waitForInterrupt(
+            Interrupt interrupt,
+            bool      active,
+            UINT32    timeoutInMsOrClockPulses
+        );
+
+        virtual
+        PERROR
+        acknowledgeInterrupt(
+            UINT16 *response
+        );
+
+        virtual
+        const BUS_STATS *
+        busStats(
+        );
+
+        virtual
+        void
+        clearBusStats(
+        );
+
+    private:
+
+        static void record(
+            UINT32 address,
+            UINT16 data,
+            UINT8  flags
+        );
+
+        ICpu *m_cpu;
+
+        static TRACE_ENTRY s_ring[c_depth];
+        static UINT8       s_next;
+        static UINT8       s_count;
+};
+
+#endif
@@ -31,11 +31,13 @@ static const ERROR s_errorSuccess          = { 0x0000, "OK!             " };
 static const ERROR s_errorNotImplemented   = { 0x0001, "E:Not Impl.     " };
 static const ERROR s_errorUnexpected       = { 0x0002, "E:Unexpected    " };
 static const ERROR s_errorTimeout          = { 0x0003, "E:Timeout       " };
+static const ERROR s_errorAborted          = { 0x0004, "E:Aborted       " };
 
 PERROR errorSuccess        = (PERROR) &s_errorSuccess;
 PERROR errorNotImplemented = (PERROR) &s_errorNotImplemented;
 PERROR errorUnexpected     = (PERROR) &s_errorUnexpected;
 PERROR errorTimeout        = (PERROR) &s_errorTimeout;
+PERROR errorAborted        = (PERROR) &s_errorAborted;
 
 //
 // Programmable error.
@@ -43,3 +45,75 @@ PERROR errorTimeout        = (PERROR) &s_errorTimeout;
 static ERROR s_errorCustom = { 0, "" };
 PERROR errorCustom         = &s_errorCustom;
 
+//
+// Detail of the last failed value check.
+//
+ERROR_DETAIL errorDetail;
+
+void stringCopy(
+    CHAR  *string,
+    PCSTR  text
+)
+{
+    string[0] = '\0';
+    stringAppend(string, text);
+}
+
+void stringAppend(
+    CHAR  *string,
+    PCSTR  text
+)
+{
+    UINT8 length = strlen(string);
+
+    while ((length < ERROR_DESCRIPTION_LENGTH) && (*text != '\0'))
+    {
+        string[length++] = *text++;
+    }
+
+    string[length] = '\0';
+}
+
+void stringAppendHex(
+    CHAR   *string,
+    UINT32  value,
+    UINT8   digits
+)
+{
+    UINT8 length = strlen(string);
+
+    //
+    // Most significant nibble first.
+    //
+    for (int shift = (digits - 1) * 4 ; (shift >= 0) && (length < ERROR_DESCRIPTION_LENGTH) ; shift -= 4)
+    {
+        UINT8 nibble = (UINT8) ((value >> shift) & 0xF);
+
+        string[length++] = (nibble < 0xA) ? ('0' + nibble) : ('a' + nibble - 0xA);
+    }
+
+    string[length] = '\0';
+}
+
+void stringAppendDec(
+    CHAR   *string,
+    UINT32  value
+)
+{
+    CHAR  digits[11]; // 4294967295 + NUL
+    UINT8 index = sizeof(digits) - 1;
+
+    digits[index] = '\0';
+
+    //
+    // Least significant digit first, working back from the end.
+    //
+    do
+    {
+        digits[--index] = '0' + (value % 10);
+        value /= 10;
+    }
+    while (value != 0);
+
+    stringAppend(string, &digits[index]);
+}
@@ -37,6 +37,7 @@ extern PERROR errorSuccess;
 extern PERROR errorNotImplemented;
 extern PERROR errorUnexpected;
 extern PERROR errorTimeout;
+extern PERROR errorAborted;
 
 //
 // This error is intended to be a programmable one that returns specific status.
@@ -44,6 +45,41 @@ extern PERROR errorTimeout;
 
 extern PERROR errorCustom;
 
+//
+// Detail of the last failed value check (e.g. address, expected & received).
+//
+
+extern ERROR_DETAIL errorDetail;
+
+//
+// Allocation free formatting of an error description in place.
+// The string is assumed to be ERROR_DESCRIPTION_LENGTH + 1 characters in size,
+// is always left NUL terminated and anything beyond the length is dropped.
+//
+
+void stringCopy(
+    CHAR  *string,
+    PCSTR  text
+);
+
+void stringAppend(
+    CHAR  *string,
+    PCSTR  text
+);
+
+// Append the value as a fixed number of lower case hex digits with leading zeros.
+void stringAppendHex(
+    CHAR   *string,
+    UINT32  value,
+    UINT8   digits
+);
+
+// Append the value in decimal without leading zeros.
+void stringAppendDec(
+    CHAR   *string,
+    UINT32  value
+);
+
 #define SUCCESS(e) (e->code == ERROR_SUCCESS)
 #define FAILED(e)  (e->code != ERROR_SUCCESS)
 
@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef IClockMasterCpu_h
+#define IClockMasterCpu_h
+
+#include "ICpu.h"
+
+//
+// Interface for the CPUs where the tester drives the master clock of the
+// board (J14 AUX pin 8) and so decides when every clock happens. With the
+// board clock owned by the tester, the state of any node can be captured
+// clock by clock and is the same on every run.
+//
+class IClockMasterCpu : public ICpu
+{
+    public:
+
+        //
+        // Run the board for one master clock.
+        //
+        virtual
+        void
+        clockPulse(
+        ) = 0;
+
+        //
+        // Run the board for 'count' master clocks as a single fast burst.
+        // Nothing is sampled or checked between the clocks.
+        //
+        virtual
+        void
+        clockPulses(
+            UINT32 count
+        ) = 0;
+
+        //
+        // The running total of master clocks since the CPU was created,
+        // including those run by the bus cycles. It wraps at 2^32 so only
+        // the difference between two reads is of use.
+        //
+        virtual
+        UINT32
+        clockCount(
+        ) = 0;
+
+};
+
+#endif
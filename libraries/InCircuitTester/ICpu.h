@@ -27,8 +27,54 @@
 
 #include "Arduino.h"
 #include "Error.h"
+#include "CArena.h"
 
-class ICpu
+//
+// When set (none-zero) each CPU keeps counters of the bus cycles it performs.
+// Build with -DCPU_BUS_STATS=0 to drop the counting from the access paths.
+//
+#ifndef CPU_BUS_STATS
+#define CPU_BUS_STATS 1
+#endif
+
+//
+// The number of log2 buckets in the cycle time histogram.
+//
+#define BUS_STATS_BUCKETS 8
+
+//
+// Bus cycle counters kept by the CPU. The histogram is of the time spent per
+// access in Timer0 ticks (4us), bucket 0 is < 1 tick and bucket n is
+// 2^(n-1) to 2^n - 1 ticks, the last bucket takes everything longer. Only
+// the drivers that synchronize to a WAIT/READY signal fill in the wait
+// counters & the histogram, the rest just count the cycles.
+//
+typedef struct _BUS_STATS {
+
+    UINT32 reads;
+    UINT32 writes;
+    UINT32 ioCycles;
+    UINT32 waitCycles;
+    UINT32 waitPolls;
+    UINT32 timeouts;
+    UINT32 interruptAcks;
+    UINT32 cycleTicks[BUS_STATS_BUCKETS];
+
+} BUS_STATS, *PBUS_STATS;
+
+#if CPU_BUS_STATS
+#define BUS_STATS_INC(field)              (m_busStats.field++)
+#define BUS_STATS_INC_IF(cond, field)     if (cond) { m_busStats.field++; }
+#define BUS_STATS_TICKS()                 ((UINT8) TCNT0)
+#define BUS_STATS_CYCLE(polls, ticks)     busStatsCycle((polls), (ticks))
+#else
+#define BUS_STATS_INC(field)
+#define BUS_STATS_INC_IF(cond, field)
+#define BUS_STATS_TICKS()                 ((UINT8) 0)
+#define BUS_STATS_CYCLE(polls, ticks)     ((void) (polls), (void) (ticks))
+#endif
+
+class ICpu : public CArenaObject
 {
     public:
 
@@ -151,6 +197,60 @@ class ICpu
             UINT16 *response
         ) = 0;
 
+        //
+        // Returns the bus cycle counters gathered since the last clear.
+        //
+        virtual
+        const BUS_STATS *
+        busStats(
+        )
+        {
+            return &m_busStats;
+        };
+
+        virtual
+        void
+        clearBusStats(
+        )
+        {
+            memset(&m_busStats, 0, sizeof(m_busStats));
+        };
+
+    protected:
+
+        ICpu(
+        )
+        {
+            memset(&m_busStats, 0, sizeof(m_busStats));
+        };
+
+        //
+        // Record one access that was timed, "polls" is the number of extra
+        // WAIT/READY polls it took (0 if it completed without being held).
+        //
+        void
+        busStatsCycle(
+            UINT16 polls,
+            UINT8  ticks
+        )
+        {
+            UINT8 bucket = 0;
+
+            for ( ; (ticks != 0) && (bucket < (BUS_STATS_BUCKETS - 1)) ; ticks >>= 1)
+            {
+                bucket++;
+            }
+
+            m_busStats.cycleTicks[bucket]++;
+
+            if (polls != 0)
+            {
+                m_busStats.waitCycles++;
+                m_busStats.waitPolls += polls;
+            }
+        };
+
+        BUS_STATS m_busStats;
 
 };
 
@@ -27,11 +27,26 @@
 
 #include "Arduino.h"
 #include "Error.h"
+#include "CArena.h"
 
-class IGame
+class IGame : public CArenaObject
 {
     public:
 
+        //
+        // The sub menus that select a region or custom function with the
+        // key moves.
+        //
+        typedef enum {
+            NO_SELECTION,
+            ROM_SELECTION,
+            RAM_SELECTION,
+            RAM_BYTE_SELECTION,
+            INPUT_SELECTION,
+            OUTPUT_SELECTION,
+            CUSTOM_SELECTION
+        } Selection;
+
         //
         // Set the CPU pins into default idle/inactive state.
         //
@@ -184,6 +199,46 @@ class IGame
             int key
         ) = 0;
 
+        //
+        // Shows the CPU bus cycle counters, the keys step through them and
+        // select clears them.
+        //
+        virtual PERROR busStats(
+            int key
+        ) = 0;
+
+        //
+        // Loops a single bus stimulus for probing with a scope until
+        // aborted, the keys step through the loop modes.
+        //
+        virtual PERROR scopeLoop(
+            int key
+        ) = 0;
+
+        //
+        // Turns the bus trace (see CTraceCpu) on or off for the tests that
+        // follow.
+        //
+        virtual void trace(
+            bool enable
+        ) = 0;
+
+        //
+        // The index of the region or custom function currently selected in
+        // the given sub menu (0 for NO_SELECTION).
+        //
+        virtual int selection(
+            Selection which
+        ) = 0;
+
+        //
+        // The reads + writes counted in the CPU's bus stats, used to give
+        // the bus cycles made by a timed test. Always 0 when the drivers are
+        // built without CPU_BUS_STATS.
+        //
+        virtual UINT32 busCycles(
+        ) = 0;
+
 };
 
 #endif
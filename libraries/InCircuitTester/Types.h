@@ -67,14 +67,30 @@ typedef const char *PCSTR;
 
 //
 // Representation of an error as a code plus description to print.
+// The description is a fixed buffer (one LCD line) so that formatting an
+// error never allocates from the heap.
 //
+#define ERROR_DESCRIPTION_LENGTH 16
+
 typedef struct _ERROR {
 
     UINT16 code;
-    String description;
+    CHAR   description[ERROR_DESCRIPTION_LENGTH + 1];
 
 } ERROR, *PERROR;
 
+//
+// The address, expected and received values behind the last failed value check.
+// This is only set by the value check macros so it needs to be cleared before use.
+//
+typedef struct _ERROR_DETAIL {
+
+    UINT32 address;
+    UINT16 expected;
+    UINT16 received;
+
+} ERROR_DETAIL, *PERROR_DETAIL;
+
 //
 // This is used as the call made based on a button selection.
 //
@@ -313,123 +329,47 @@ typedef struct _INTERRUPT_DEFINITION {
 
 //
 // Macro to format a UINT8 hex value into a string with leading zeros.
-// The Arduino String library does not appear to have an option to do this.
+// Formatted in place by stringAppendHex (see Error.h) without the heap.
 //
 
 #define STRING_UINT8_HEX(string, value)                     \
     {                                                       \
-        UINT8 value8 = (UINT8) value;                       \
-                                                            \
-        if (value8 <= 0xF)                                  \
-        {                                                   \
-            string += " 0" + String(value8, HEX);           \
-        }                                                   \
-        else                                                \
-        {                                                   \
-            string += " "  + String(value8, HEX);           \
-        }                                                   \
+        stringAppend(string, " ");                          \
+        stringAppendHex(string, (UINT8) (value), 2);        \
     }                                                       \
 
 //
 // Macro to format a UINT16 hex value into a string with leading zeros.
-// The Arduino String library does not appear to have an option to do this.
+// Formatted in place by stringAppendHex (see Error.h) without the heap.
 //
 
 #define STRING_UINT16_HEX(string, value)                      \
     {                                                         \
-        UINT16 value16 = (UINT16) value;                      \
-                                                              \
-        if (value16 <= 0xF)                                   \
-        {                                                     \
-            string += " 000" + String(value16, HEX);          \
-        }                                                     \
-        else if (value16 <= 0xFF)                             \
-        {                                                     \
-            string += " 00" + String(value16, HEX);           \
-        }                                                     \
-        else if (value16 <= 0xFFF)                            \
-        {                                                     \
-            string += " 0" + String(value16, HEX);            \
-        }                                                     \
-        else                                                  \
-        {                                                     \
-            string += " " + String(value16, HEX);             \
-        }                                                     \
+        stringAppend(string, " ");                            \
+        stringAppendHex(string, (UINT16) (value), 4);         \
     }                                                         \
 
 //
 // Macro to format a UINT32 24-bit hex value into a string with leading zeros.
-// The Arduino String library does not appear to have an option to do this.
+// Formatted in place by stringAppendHex (see Error.h) without the heap.
 //
 
 #define STRING_UINT32_24_HEX(string, value)                  \
     {                                                        \
-        if (value <= 0xF)                                    \
-        {                                                    \
-            string += " 00000" + String(value, HEX);         \
-        }                                                    \
-        else if (value <= 0xFF)                              \
-        {                                                    \
-            string += " 0000" + String(value, HEX);          \
-        }                                                    \
-        else if (value <= 0xFFF)                             \
-        {                                                    \
-            string += " 000" + String(value, HEX);           \
-        }                                                    \
-        else if (value <= 0xFFFF)                            \
-        {                                                    \
-            string += " 00" + String(value, HEX);            \
-        }                                                    \
-        else if (value <= 0xFFFFF)                           \
-        {                                                    \
-            string += " 0" + String(value, HEX);             \
-        }                                                    \
-        else                                                 \
-        {                                                    \
-            string += " " + String((value & 0xFFFFFF), HEX); \
-        }                                                    \
+        stringAppend(string, " ");                           \
+        stringAppendHex(string, (UINT32) (value), 6);        \
     }                                                        \
 
 
 //
 // Macro to format a UINT32 hex value into a string with leading zeros.
-// The Arduino String library does not appear to have an option to do this.
+// Formatted in place by stringAppendHex (see Error.h) without the heap.
 //
 
 #define STRING_UINT32_HEX(string, value)               \
     {                                                  \
-        if (value <= 0xF)                              \
-        {                                              \
-            string += " 0000000" + String(value, HEX); \
-        }                                              \
-        else if (value <= 0xFF)                        \
-        {                                              \
-            string += " 000000" + String(value, HEX);  \
-        }                                              \
-        else if (value <= 0xFFF)                       \
-        {                                              \
-            string += " 00000" + String(value, HEX);   \
-        }                                              \
-        else if (value <= 0xFFFF)                      \
-        {                                              \
-            string += " 0000" + String(value, HEX);    \
-        }                                              \
-        else if (value <= 0xFFFFF)                     \
-        {                                              \
-            string += " 000" + String(value, HEX);     \
-        }                                              \
-        else if (value <= 0xFFFFFF)                    \
-        {                                              \
-            string += " 00" + String(value, HEX);      \
-        }                                              \
-        else if (value <= 0xFFFFFFF)                   \
-        {                                              \
-            string += " 0" + String(value, HEX);       \
-        }                                              \
-        else                                           \
-        {                                              \
-            string += " " + String(value, HEX);        \
-        }                                              \
+        stringAppend(string, " ");                     \
+        stringAppendHex(string, (UINT32) (value), 8);  \
     }                                                  \
 
 //
@@ -465,10 +405,10 @@ typedef struct _INTERRUPT_DEFINITION {
             {                                                                   \
                 error = errorCustom;                                            \
                 error->code = ERROR_FAILED;                                     \
-                error->description = "E:";                                      \
-                error->description += message;                                  \
-                error->description += (expValue) ? " Hi" : " Lo";               \
-                error->description += (recValue) ? " Hi" : " Lo";               \
+                stringCopy(error->description, "E:");                           \
+                stringAppend(error->description, message);                      \
+                stringAppend(error->description, (expValue) ? " Hi" : " Lo");   \
+                stringAppend(error->description, (recValue) ? " Hi" : " Lo");   \
                 goto Exit;                                                      \
             }                                                                   \
         }                                                                       \
@@ -482,8 +422,10 @@ typedef struct _INTERRUPT_DEFINITION {
             {                                                                   \
                 error = errorCustom;                                            \
                 error->code = ERROR_FAILED;                                     \
-                error->description = "E:";                                      \
-                error->description += message;                                  \
+                ERROR_DETAIL detail = { 0, (UINT16) (expValue), (UINT16) (recValue) };   \
+                errorDetail = detail;                                           \
+                stringCopy(error->description, "E:");                           \
+                stringAppend(error->description, message);                      \
                 STRING_UINT8_HEX(error->description, expValue);                 \
                 STRING_UINT8_HEX(error->description, recValue);                 \
                 goto Exit;                                                      \
@@ -499,8 +441,10 @@ typedef struct _INTERRUPT_DEFINITION {
         {                                                                   \
             error = errorCustom;                                            \
             error->code = ERROR_FAILED;                                     \
-            error->description = "E:";                                      \
-            error->description += message;                                  \
+            ERROR_DETAIL detail = { 0, (UINT16) (expValue), (UINT16) (recValue) };   \
+            errorDetail = detail;                                           \
+            stringCopy(error->description, "E:");                           \
+            stringAppend(error->description, message);                      \
             STRING_UINT16_HEX(error->description, expValue);                \
             STRING_UINT16_HEX(error->description, recValue);                \
             goto Exit;                                                      \
@@ -516,11 +460,11 @@ typedef struct _INTERRUPT_DEFINITION {
         {                                                                   \
             error = errorCustom;                                            \
             error->code = ERROR_FAILED;                                     \
-            error->description = "E:";                                      \
-            error->description += connection.name;                          \
-            error->description += connection.pin;                           \
-            error->description += (recValue == HIGH) ? " Hi " : " Lo ";     \
-            error->description += __LINE__;                                 \
+            stringCopy(error->description, "E:");                           \
+            stringAppend(error->description, connection.name);              \
+            stringAppendDec(error->description, connection.pin);            \
+            stringAppend(error->description, (recValue == HIGH) ? " Hi " : " Lo "); \
+            stringAppendDec(error->description, __LINE__);                  \
             goto Exit;                                                      \
         }                                                                   \
     }                                                                       \
@@ -555,8 +499,8 @@ typedef struct _INTERRUPT_DEFINITION {
         {                                                                \
             error = errorCustom;                                         \
             error->code = ERROR_FAILED;                                  \
-            error->description  = "E:";                                  \
-            error->description += connection[0].name;                    \
+            stringCopy(error->description, "E:");                        \
+            stringAppend(error->description, connection[0].name);        \
             STRING_UINT8_HEX(error->description, expValue);              \
             STRING_UINT8_HEX(error->description, value);                 \
             goto Exit;                                                   \
@@ -575,8 +519,8 @@ typedef struct _INTERRUPT_DEFINITION {
         {                                                             \
             error = errorCustom;                                      \
             error->code = ERROR_FAILED;                               \
-            error->description  = "E:";                               \
-            error->description += connection[0].name;                 \
+            stringCopy(error->description, "E:");                     \
+            stringAppend(error->description, connection[0].name);     \
             STRING_UINT16_HEX(error->description, value);             \
             goto Exit;                                                \
         }                                                             \
@@ -594,8 +538,10 @@ typedef struct _INTERRUPT_DEFINITION {
         {                                                                    \
             error = errorCustom;                                             \
             error->code = ERROR_FAILED;                                      \
-            error->description = "E:";                                       \
-            error->description += string;                                    \
+            ERROR_DETAIL detail = { (UINT32) (address), (UINT16) (expValue), (UINT16) (recValue) }; \
+            errorDetail = detail;                                            \
+            stringCopy(error->description, "E:");                            \
+            stringAppend(error->description, string);                        \
             STRING_UINT16_HEX(error->description, address);                  \
             STRING_UINT8_HEX(error->description, expValue);                  \
             STRING_UINT8_HEX(error->description, recValue);                  \
@@ -615,8 +561,10 @@ typedef struct _INTERRUPT_DEFINITION {
         {                                                                    \
             error = errorCustom;                                             \
             error->code = ERROR_FAILED;                                      \
-            error->description = "E:";                                       \
-            error->description += string;                                    \
+            ERROR_DETAIL detail = { (UINT32) (address), (UINT16) (expValue), (UINT16) (recValue) }; \
+            errorDetail = detail;                                            \
+            stringCopy(error->description, "E:");                            \
+            stringAppend(error->description, string);                        \
             STRING_UINT16_HEX(error->description, expValue);                 \
             STRING_UINT16_HEX(error->description, recValue);                 \
             break;                                                           \
@@ -631,12 +579,12 @@ typedef struct _INTERRUPT_DEFINITION {
 #define STRING_REGION8_SUMMARY(error, start, mask, location)   \
     {                                                          \
         error->code = ERROR_SUCCESS;                           \
-        error->description = "";                               \
+        stringCopy(error->description, "");                    \
         STRING_UINT32_24_HEX(error->description, start);       \
-        error->description += " ";                             \
+        stringAppend(error->description, " ");                 \
         STRING_UINT8_HEX(error->description, mask);            \
-        error->description += " ";                             \
-        error->description += location;                        \
+        stringAppend(error->description, " ");                 \
+        stringAppend(error->description, location);            \
     }                                                          \
 
 //
@@ -647,12 +595,12 @@ typedef struct _INTERRUPT_DEFINITION {
 #define STRING_REGION16_SUMMARY(error, start, mask, location)  \
     {                                                          \
         error->code = ERROR_SUCCESS;                           \
-        error->description = "";                               \
+        stringCopy(error->description, "");                    \
         STRING_UINT32_24_HEX(error->description, start);       \
-        error->description += " ";                             \
+        stringAppend(error->description, " ");                 \
         STRING_UINT16_HEX(error->description, mask);           \
-        error->description += " ";                             \
-        error->description += location;                        \
+        stringAppend(error->description, " ");                 \
+        stringAppend(error->description, location);            \
     }                                                          \
 
 //
@@ -663,12 +611,12 @@ typedef struct _INTERRUPT_DEFINITION {
 #define STRING_IO8_SUMMARY(error, location, mask, regionDescription)  \
     {                                                                \
         error->code = ERROR_SUCCESS;                                 \
-        error->description = "";                                     \
-        error->description += " ";                                   \
-        error->description += location;                              \
+        stringCopy(error->description, "");                          \
+        stringAppend(error->description, " ");                       \
+        stringAppend(error->description, location);                  \
         STRING_UINT8_HEX(error->description, mask);                  \
-        error->description += " ";                                   \
-        error->description += regionDescription;                     \
+        stringAppend(error->description, " ");                       \
+        stringAppend(error->description, regionDescription);         \
     }                                                                \
 
 //
@@ -679,12 +627,12 @@ typedef struct _INTERRUPT_DEFINITION {
 #define STRING_IO16_SUMMARY(error, location, mask, regionDescription)  \
     {                                                                \
         error->code = ERROR_SUCCESS;                                 \
-        error->description = "";                                     \
-        error->description += " ";                                   \
-        error->description += location;                              \
+        stringCopy(error->description, "");                          \
+        stringAppend(error->description, " ");                       \
+        stringAppend(error->description, location);                  \
         STRING_UINT16_HEX(error->description, mask);                 \
-        error->description += " ";                                   \
-        error->description += regionDescription;                     \
+        stringAppend(error->description, " ");                       \
+        stringAppend(error->description, regionDescription);         \
     }                                                                \
 
 //
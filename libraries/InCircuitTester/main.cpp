@@ -29,6 +29,12 @@
 #include <LiquidCrystal.h>
 #include <DFR_Key.h>
 #include <CGameCallback.h>
+#include <CScheduler.h>
+#include <CFailureLog.h>
+#include <CRegion.h>
+#include <CArena.h>
+#include <CTestTiming.h>
+#include <CTraceCpu.h>
 
 //
 // Basic LCD diplay object (in this case, Sain 16 x 2).
@@ -47,20 +53,42 @@ static DFR_Key keypad;
 static const UINT8 led = 13;
 
 //
-// This is the current selector.
+// True whilst a selection is running. Used by the busy task to blink
+// the busy marker on the LCD.
+//
+static bool s_busy;
+
+//
+// This is the current selector. All selectors are in PROGMEM and are read
+// one selection at a time through getSelection.
 //
 static const SELECTOR *s_currentSelector;
 
 //
-// This is the game selector.
+// This is the game selector. It's the configuration selections followed
+// by the games supplied at setup.
 //
-static SELECTOR *s_gameSelector;
+static const SELECTOR *s_gameSelector;
 
 //
 // This is the current selection.
 //
 static int s_currentSelection;
 
+//
+// The PROGMEM game selector supplied at setup, the number of configuration
+// selections in front of it in the game selector and the index of the
+// current game within it. Used to identify the game in the failure log.
+//
+static const SELECTOR *s_progMemGameSelector;
+static UINT8 s_configSelections;
+static UINT8 s_gameId;
+
+//
+// The failure log record currently displayed by the show log selector.
+//
+static UINT16 s_logIndex;
+
 //
 // When true causes the soak test to run as soon as a game is selected.
 //
@@ -73,10 +101,72 @@ bool s_runSoakTest;
 int s_repeatSelectTimeInS;
 
 //
-// When true causes the repeat to ignore any reported error and continue the repeat
+// When true causes the repeat to ignore any reported error and continue the repeat.
+// The soak test also uses this to record failures and carry on.
 //
 bool s_repeatIgnoreError;
 
+//
+// When true each test is checked on completion that the stack & heap haven't
+// got within c_memoryGuardBytes of each other and the repeat is stopped if they
+// have, rather than carrying on with corrupted state.
+//
+bool s_memoryGuard;
+
+static bool s_memoryCollision;
+
+static const int c_memoryGuardBytes = 64;
+
+//
+// When true the game's CPU accesses are recorded by CTraceCpu whilst a test
+// runs. The trace is sent to the serial port if the test fails and can be
+// scrolled through with "Show Trace".
+//
+static bool s_busTrace;
+
+static UINT8 s_traceIndex;
+
+//
+// Per selection statistics gathered by the soak test. The min/max durations
+// saturate at 0xFFFF ms, the total is used to calculate the average. The run
+// counts are 32-bit as the cheap tests can pass 65535 runs overnight.
+//
+typedef struct _SOAK_STATS {
+    UINT32 runs;
+    UINT32 failures;
+    UINT16 minMs;
+    UINT16 maxMs;
+    UINT32 totalMs;
+    bool   notImplemented;
+} SOAK_STATS;
+
+//
+// The soak test selector is small so a fixed table is used rather than
+// allocating one per soak test.
+//
+static const UINT8 c_maxSoakSelections = 12;
+
+static SOAK_STATS s_soakStats[c_maxSoakSelections];
+
+static UINT8 s_soakNumSelections;
+
+//
+// The selection currently displayed by the soak stats selector.
+//
+static UINT8 s_soakStatsSelection;
+
+//
+// The scheduling weight of a selection that has not yet been run and the
+// average duration above which the weight starts to be reduced.
+//
+static const UINT8  c_soakWeightMax = 16;
+static const UINT32 c_soakWeightMs  = 250;
+
+//
+// The full stats table is sent to the serial port after this many loops.
+//
+static const int c_soakStatsLoops = 32;
+
 //
 // The selector used for the general tester configuration options.
 //
@@ -84,9 +174,384 @@ static const SELECTOR s_configSelector[] PROGMEM = {//0123456789abcde
                                                     {"- Soak Test    ",  onSelectConfig, (void*) (&s_runSoakTest),           false},
                                                     {"- Set Repeat   ",  onSelectConfig, (void*) (&s_repeatSelectTimeInS),   false},
                                                     {"- Set Error    ",  onSelectConfig, (void*) (&s_repeatIgnoreError),     false},
+                                                    {"- Mem Guard    ",  onSelectConfig, (void*) (&s_memoryGuard),           false},
+                                                    {"- Bus Trace    ",  onSelectConfig, (void*) (&s_busTrace),              false},
+                                                    {"- Show Trace   ",  onSelectShowTrace, NULL,                            true},
+                                                    {"- Show Log     ",  onSelectShowLog, NULL,                              true},
                                                     { 0, 0 }
                                                    };
 
+//
+// Scheduler task to flash the heartbeat LED.
+//
+static void
+onHeartbeatTask(
+    void *context
+)
+{
+    digitalWrite(led, !digitalRead(led));
+}
+
+//
+// Scheduler task to scan the keypad and queue any key change.
+// Pressing a new key whilst a selection is running requests an abort.
+//
+static void
+onKeypadTask(
+    void *context
+)
+{
+    static int lastKey = NO_KEY;
+    int key = keypad.getKey();
+
+    if (key != SAMPLE_WAIT)
+    {
+        if (s_busy && (key != NO_KEY) && (key != lastKey))
+        {
+            CScheduler::requestAbort();
+        }
+
+        lastKey = key;
+
+        CScheduler::putKey(key);
+    }
+}
+
+//
+// Copy a selection into the supplied entry. For the game selector, the
+// selections after the configuration selections come from the game selector
+// supplied at setup. Returns false at the end of list marker.
+//
+static bool
+getSelection(
+    const SELECTOR *selector,
+    int            selection,
+    SELECTOR       *entry
+)
+{
+    if ((selector == s_gameSelector) && (selection >= s_configSelections))
+    {
+        selector   = s_progMemGameSelector;
+        selection -= s_configSelections;
+    }
+
+    return CRegion::get(selector, selection, entry);
+}
+
+//
+// Encode the current selection for the failure log.
+//
+static UINT8
+logSelection(
+    const SELECTOR *selector,
+    int selection
+)
+{
+    UINT8 logSelector = CFailureLog::c_selectorGame;
+
+    if (selector == CGameCallback::selectorGeneric)
+    {
+        logSelector = CFailureLog::c_selectorGeneric;
+    }
+    else if (selector == CGameCallback::selectorSoakTest)
+    {
+        logSelector = CFailureLog::c_selectorSoakTest;
+    }
+
+    return logSelector | (selection & CFailureLog::c_selectionMask);
+}
+
+//
+// Add a failure to the log unless it's one that doesn't indicate a fault.
+//
+static void
+logFailure(
+    const SELECTOR *selector,
+    int selection,
+    PERROR error
+)
+{
+    if (FAILED(error)                     &&
+        (error != errorNotImplemented)    &&
+        (error != errorAborted))
+    {
+        CFailureLog::add(s_gameId, logSelection(selector, selection), error);
+    }
+}
+
+//
+// The description of the selection recorded in the failure log.
+//
+static const __FlashStringHelper *
+logSelectionDescription(
+    UINT8 logSelection
+)
+{
+    const SELECTOR *selector = CGameCallback::selectorGame;
+    UINT8 selection = logSelection & CFailureLog::c_selectionMask;
+
+    switch (logSelection & CFailureLog::c_selectorMask)
+    {
+        case CFailureLog::c_selectorGeneric  : { selector = CGameCallback::selectorGeneric;  break; }
+        case CFailureLog::c_selectorSoakTest : { selector = CGameCallback::selectorSoakTest; break; }
+        default : { break; }
+    }
+
+    if (selection >= CRegion::count(selector))
+    {
+        return F("?");
+    }
+
+    return (const __FlashStringHelper *) selector[selection].description;
+}
+
+//
+// Send the failure log to the serial port, newest first, one line per record
+// in the form:
+// LOG,index,sequence,timeInS,game,selection,code,address,expected,received
+//
+static void
+logPrint(
+)
+{
+    UINT16 numGames = CRegion::count(s_progMemGameSelector);
+
+    for (UINT16 index = 0 ; index < CFailureLog::count() ; index++)
+    {
+        CFailureLog::RECORD record;
+
+        Serial.print("LOG,");
+        Serial.print(index, DEC);
+        Serial.print(',');
+
+        if (!CFailureLog::get(index, &record))
+        {
+            Serial.println("Bad record");
+            continue;
+        }
+
+        Serial.print(record.sequence, DEC);
+        Serial.print(',');
+        Serial.print((UINT32) record.timeInS, DEC);
+        Serial.print(',');
+
+        if (record.gameId < numGames)
+        {
+            Serial.print((const __FlashStringHelper *) s_progMemGameSelector[record.gameId].description);
+        }
+
+        Serial.print(',');
+        Serial.print(logSelectionDescription(record.selection));
+        Serial.print(',');
+        Serial.print((UINT8) record.code, HEX);
+        Serial.print(',');
+        Serial.print((UINT32) record.address, HEX);
+        Serial.print(',');
+        Serial.print(record.expected, HEX);
+        Serial.print(',');
+        Serial.println(record.received, HEX);
+    }
+
+    Serial.println("LOG,End");
+}
+
+//
+// Scheduler task to poll the serial port.
+// Any character received whilst a selection is running requests an abort.
+// Otherwise the characters are commands:
+//  D - Dump the failure log.
+//  C - Clear the failure log.
+//
+static void
+onSerialTask(
+    void *context
+)
+{
+    while (Serial.available() > 0)
+    {
+        int command = Serial.read();
+
+        if (s_busy)
+        {
+            CScheduler::requestAbort();
+        }
+        else if ((command == 'D') || (command == 'd'))
+        {
+            logPrint();
+        }
+        else if ((command == 'C') || (command == 'c'))
+        {
+            CFailureLog::clear();
+            Serial.println("LOG,Cleared");
+        }
+    }
+}
+
+//
+// Scheduler task to blink the busy marker whilst a selection is running
+// so that a hung bus cycle can be told apart from a long test.
+//
+static void
+onBusyTask(
+    void *context
+)
+{
+    static bool marker;
+
+    if (s_busy)
+    {
+        UINT8 progress = CScheduler::progress();
+
+        marker = !marker;
+
+        lcd.setCursor(0, 1);
+        lcd.print(marker ? ' ' : BLANK_LINE_16[0]);
+
+        if (progress != CScheduler::c_noProgress)
+        {
+            lcd.print(' ');
+            lcd.print(progress, DEC);
+            lcd.print("% ");
+        }
+    }
+}
+
+//
+// Send the stack & heap high water marks of the last selection run to the
+// serial port in the form:
+// MEM,selection,stack,heap,lowFree
+//
+static void
+memoryPrint(
+    const SELECTOR *selection
+)
+{
+    Serial.print("MEM,");
+    Serial.print(selection->description);
+    Serial.print(',');
+    Serial.print(stackHighWater(), DEC);
+    Serial.print(',');
+    Serial.print(heapHighWater(), DEC);
+    Serial.print(',');
+    Serial.println(freeMemoryLowWater(), DEC);
+}
+
+//
+// Send the bus trace to the serial port, most recent access first, in the form:
+// TRACE,index,R/W,address,data,F
+// where the F is only present on the access that returned an error.
+//
+static void
+tracePrint(
+)
+{
+    TRACE_ENTRY entry;
+
+    for (UINT8 index = 0 ; CTraceCpu::get(index, &entry) ; index++)
+    {
+        Serial.print("TRACE,");
+        Serial.print(index, DEC);
+        Serial.print((entry.flags & TRACE_FLAG_WRITE) ? ",W," : ",R,");
+        Serial.print(entry.address, HEX);
+        Serial.print(',');
+        Serial.print(entry.data, HEX);
+        Serial.println((entry.flags & TRACE_FLAG_FAILED) ? ",F" : "");
+    }
+
+    Serial.println("TRACE,End");
+}
+
+//
+// Leave the bus idle after an aborted selection rather than wherever the
+// test happened to stop.
+//
+static void
+onAborted(
+)
+{
+    if (CGameCallback::game != NULL)
+    {
+        CGameCallback::game->busIdle();
+    }
+
+    CScheduler::clearAbort();
+}
+
+//
+// Override of the Arduino core yield so that the scheduler tasks also run
+// whilst in any delay().
+//
+void
+yield(
+)
+{
+    CScheduler::yield();
+}
+
+#if TEST_TIMING
+
+//
+// Append a duration using the unit that keeps it short, e.g. "850us" or "1234ms".
+//
+static void
+timingAppend(
+    CHAR   *string,
+    UINT32 us
+)
+{
+    if (us < 10000)
+    {
+        stringAppendDec(string, us);
+        stringAppend(string, "us");
+    }
+    else if (us < 100000000)
+    {
+        stringAppendDec(string, us / 1000);
+        stringAppend(string, "ms");
+    }
+    else
+    {
+        stringAppendDec(string, us / 1000000);
+        stringAppend(string, "s");
+    }
+}
+
+//
+// Show the last/best duration of the test just run at the end of the result
+// line of the LCD, when it fits after the result, and send it to the serial
+// port in the form:
+// TIME,selection,lastUs,bestUs,busCycles
+//
+static void
+timingPrint(
+    const SELECTOR *selection,
+    PERROR         error
+)
+{
+    CHAR description[ERROR_DESCRIPTION_LENGTH + 1] = "";
+
+    timingAppend(description, CTestTiming::lastUs());
+    stringAppend(description, "/");
+    timingAppend(description, CTestTiming::bestUs());
+
+    if ((strlen(error->description) + 1 + strlen(description)) <= 16)
+    {
+        lcd.setCursor(16 - strlen(description), 1);
+        lcd.print(description);
+    }
+
+    Serial.print("TIME,");
+    Serial.print(selection->description);
+    Serial.print(',');
+    Serial.print(CTestTiming::lastUs(), DEC);
+    Serial.print(',');
+    Serial.print(CTestTiming::bestUs(), DEC);
+    Serial.print(',');
+    Serial.println(CTestTiming::lastBusCycles(), DEC);
+}
+
+#endif
+
 //
 // Handler for the configuration callback to set options.
 //
@@ -113,7 +578,9 @@ onSelectConfig(
             s_repeatSelectTimeInS = 0;
         }
 
-        errorCustom->description = String("OK: Repeat ") + String(s_repeatSelectTimeInS, DEC) + String("S");
+        stringCopy(errorCustom->description, "OK: Repeat ");
+        stringAppendDec(errorCustom->description, s_repeatSelectTimeInS);
+        stringAppend(errorCustom->description, "S");
         errorCustom->code = ERROR_SUCCESS;
     }
 
@@ -122,12 +589,12 @@ onSelectConfig(
         if (s_repeatIgnoreError == false)
         {
             s_repeatIgnoreError = true;
-            errorCustom->description = "OK: Ignore err";
+            stringCopy(errorCustom->description, "OK: Ignore err");
         }
         else
         {
             s_repeatIgnoreError = false;
-            errorCustom->description = "OK: Stop on err";
+            stringCopy(errorCustom->description, "OK: Stop on err");
         }
 
         errorCustom->code = ERROR_SUCCESS;
@@ -138,12 +605,44 @@ onSelectConfig(
         if (s_runSoakTest == false)
         {
             s_runSoakTest = true;
-            errorCustom->description = "OK: Soak Test";
+            stringCopy(errorCustom->description, "OK: Soak Test");
         }
         else
         {
             s_runSoakTest = false;
-            errorCustom->description = "OK: Manual";
+            stringCopy(errorCustom->description, "OK: Manual");
+        }
+
+        errorCustom->code = ERROR_SUCCESS;
+    }
+
+    if (context == (void *) &s_busTrace)
+    {
+        if (s_busTrace == false)
+        {
+            s_busTrace = true;
+            stringCopy(errorCustom->description, "OK: Trace On");
+        }
+        else
+        {
+            s_busTrace = false;
+            stringCopy(errorCustom->description, "OK: Trace Off");
+        }
+
+        errorCustom->code = ERROR_SUCCESS;
+    }
+
+    if (context == (void *) &s_memoryGuard)
+    {
+        if (s_memoryGuard == false)
+        {
+            s_memoryGuard = true;
+            stringCopy(errorCustom->description, "OK: Guard On");
+        }
+        else
+        {
+            s_memoryGuard = false;
+            stringCopy(errorCustom->description, "OK: Guard Off");
         }
 
         errorCustom->code = ERROR_SUCCESS;
@@ -167,37 +666,48 @@ onSelectGameCallback(
     PERROR error = errorSuccess;
     GameConstructor gameConstructor = (GameConstructor) context;
 
+    // The game selector starts with the configuration selections.
+    s_gameId = (UINT8) (s_currentSelection - s_configSelections);
+
     // Assign the new selector for the game
     s_currentSelector  = selector;
     s_currentSelection = 0;
 
-    // Free the game selector memory before we construct the game.
-    if (s_gameSelector != NULL)
-    {
-        free(s_gameSelector);
-        s_gameSelector = NULL;
-    }
-
     if (CGameCallback::game != NULL)
     {
         delete CGameCallback::game;
         CGameCallback::game = (IGame *) NULL;
     }
 
+    // Everything the old game allocated is reclaimed in one go.
+    CArena::reset();
+
+#if TEST_TIMING
+    CTestTiming::reset();
+#endif
+
     // Construct the game object
     CGameCallback::game = (IGame *) gameConstructor();
 
-    // After game construction check the free memory
+    // After game construction check the free memory and the arena use (used/high water).
     {
-        String description = " ";
+        CHAR description[ERROR_DESCRIPTION_LENGTH + 1] = " ";
 
-        description += freeMemory();
-        description += "b free";
+        stringAppendDec(description, freeMemory());
+        stringAppend(description, "b free");
 
         lcd.clear();
         lcd.setCursor(0, 0);
         lcd.print(description);
 
+        stringCopy(description, " Arena ");
+        stringAppendDec(description, CArena::used());
+        stringAppend(description, "/");
+        stringAppendDec(description, CArena::highWater());
+
+        lcd.setCursor(0, 1);
+        lcd.print(description);
+
         delay(1000);
     }
 
@@ -244,6 +754,117 @@ onSelectGeneric(
                                 CGameCallback::selectorGeneric);
 }
 
+//
+// Calculate the soak test scheduling weight of a selection. Cheap selections
+// and those that have been finding failures are run more often and selections
+// that are not implemented by the game are not run at all.
+//
+static UINT8
+soakWeight(
+    const SELECTOR   *selector,
+    const SOAK_STATS *stats
+)
+{
+    UINT8 weight = c_soakWeightMax;
+
+    // Sub menu selections need key input so are not part of the soak test.
+    if (selector->subMenu || stats->notImplemented)
+    {
+        return 0;
+    }
+
+    if (stats->runs != 0)
+    {
+        // Halve the weight for each doubling of the average duration.
+        for (UINT32 avgMs = stats->totalMs / stats->runs ; (avgMs > c_soakWeightMs) && (weight > 1) ; avgMs >>= 1)
+        {
+            weight >>= 1;
+        }
+
+        // Add up to the maximum again in proportion to the failure rate.
+        weight += (UINT8) (((UINT32) c_soakWeightMax * stats->failures) / stats->runs);
+    }
+
+    return weight;
+}
+
+//
+// Record the result of a single selection run in the soak test statistics.
+//
+static void
+soakRecord(
+    SOAK_STATS    *stats,
+    PERROR        error,
+    unsigned long durationInMs
+)
+{
+    UINT16 ms = (durationInMs > 0xFFFF) ? 0xFFFF : (UINT16) durationInMs;
+
+    if (error == errorNotImplemented)
+    {
+        stats->notImplemented = true;
+        return;
+    }
+
+    if ((stats->runs == 0) || (ms < stats->minMs))
+    {
+        stats->minMs = ms;
+    }
+
+    if (ms > stats->maxMs)
+    {
+        stats->maxMs = ms;
+    }
+
+    stats->totalMs += durationInMs;
+    stats->runs++;
+
+    if (FAILED(error))
+    {
+        stats->failures++;
+    }
+}
+
+//
+// Send the soak test statistics table to the serial port, one line per
+// selection in the form:
+// STAT,index,description,runs,passes,failures,minMs,avgMs,maxMs
+//
+static void
+soakStatsPrint(
+)
+{
+    for (UINT8 i = 0 ; i < s_soakNumSelections ; i++)
+    {
+        const SOAK_STATS *stats = &s_soakStats[i];
+        SELECTOR selection;
+
+        CRegion::get(CGameCallback::selectorSoakTest, i, &selection);
+
+        if (selection.subMenu)
+        {
+            continue;
+        }
+
+        Serial.print("STAT,");
+        Serial.print(i, DEC);
+        Serial.print(',');
+        Serial.print(selection.description);
+        Serial.print(',');
+        Serial.print(stats->runs, DEC);
+        Serial.print(',');
+        Serial.print(stats->runs - stats->failures, DEC);
+        Serial.print(',');
+        Serial.print(stats->failures, DEC);
+        Serial.print(',');
+        Serial.print(stats->minMs, DEC);
+        Serial.print(',');
+        Serial.print((stats->runs != 0) ? (stats->totalMs / stats->runs) : 0, DEC);
+        Serial.print(',');
+        Serial.println(stats->maxMs, DEC);
+    }
+}
+
 //
 // Handler for the soak test select callback that will run the soak test
 // for the current game forever (if no error occurs).
@@ -256,56 +877,131 @@ onSelectSoakTest(
 {
     PERROR error = errorNotImplemented;
     const SELECTOR *selector = CGameCallback::selectorSoakTest;
-    int numSelections = 0;
+    SELECTOR entry;
     int selection = 0;
     int loop = 1;
+    UINT32 failures = 0;
 
     //
-    // Count up how many selections were provided.
+    // Count up how many selections were provided and clear down the stats.
     //
-    while(selector[numSelections].function != NULL)
-    {
-        numSelections++;
-    }
+    s_soakNumSelections = min(CRegion::count(selector), c_maxSoakSelections);
+
+    memset(s_soakStats, 0, sizeof(s_soakStats));
+
+    s_soakStatsSelection = 0;
 
     //
-    // Loop to execute selections in random order forever.
+    // Loop to execute selections in weighted random order forever.
     //
     do
     {
-        String status = "* ";
+        CHAR status[ERROR_DESCRIPTION_LENGTH + 1] = "";
+        unsigned long totalWeight = 0;
+        unsigned long startTime;
+        long choice;
+
+        for (selection = 0 ; selection < s_soakNumSelections ; selection++)
+        {
+            CRegion::get(selector, selection, &entry);
+
+            totalWeight += soakWeight(&entry, &s_soakStats[selection]);
+        }
 
         //
-        // The random function seems to be averse to selecting 0
-        // so this adjusts the range to skew a bit more towards 0
+        // Nothing left to run if the game didn't implement any of the selections.
         //
-        selection = random(numSelections + 1);
-        if (selection != 0)
+        if (totalWeight == 0)
         {
-            selection--;
+            error = errorNotImplemented;
+            selection = 0;
+            break;
+        }
+
+        choice = random(totalWeight);
+
+        for (selection = 0 ; selection < s_soakNumSelections ; selection++)
+        {
+            CRegion::get(selector, selection, &entry);
+
+            choice -= soakWeight(&entry, &s_soakStats[selection]);
+
+            if (choice < 0)
+            {
+                break;
+            }
         }
 
         lcd.clear();
         lcd.setCursor(0, 0);
-        lcd.print(selector[selection].description);
+        lcd.print(entry.description);
 
-        lcd.setCursor(0, 1);
-        status += loop;
+        // Leave room for the busy marker and progress.
+        stringAppendDec(status, loop);
+        stringAppend(status, " F");
+        stringAppendDec(status, failures);
+
+        lcd.setCursor(16 - strlen(status), 1);
         lcd.print(status);
 
-        error = selector[selection].function(
-                   selector[selection].context,
+        CScheduler::clearProgress();
+
+        memset(&errorDetail, 0, sizeof(errorDetail));
+
+        startTime = millis();
+
+        error = entry.function(
+                   entry.context,
                    SELECT_KEY );
 
+        //
+        // Not all selections check for abort so check here as well.
+        // An aborted selection isn't recorded in the stats.
+        //
+        if (CScheduler::aborted())
+        {
+            error = errorAborted;
+            break;
+        }
+
+        soakRecord(&s_soakStats[selection], error, millis() - startTime);
+
         //
         // Some games may not implement all the selections so account for
-        // not implemented errors as benign.
+        // not implemented errors as benign. The selection won't be run again.
         //
         if (error == errorNotImplemented)
         {
             error = errorSuccess;
         }
 
+        if (FAILED(error))
+        {
+            failures++;
+
+            logFailure(selector, selection, error);
+
+            Serial.print("FAIL,");
+            Serial.print(loop, DEC);
+            Serial.print(',');
+            Serial.print(entry.description);
+            Serial.print(',');
+            Serial.println(error->description);
+
+            //
+            // The failure has been recorded so carry on if errors are being ignored.
+            //
+            if (s_repeatIgnoreError)
+            {
+                error = errorSuccess;
+            }
+        }
+
+        if ((loop % c_soakStatsLoops) == 0)
+        {
+            soakStatsPrint();
+        }
+
         //
         // The reset of the seed based on the loop count is done because the
         // tests reset the random seed so on exit the result of "random" could
@@ -316,6 +1012,8 @@ onSelectSoakTest(
     }
     while (SUCCESS(error));
 
+    soakStatsPrint();
+
     //
     // If we get an error, leave the selector set and parked at the failing
     // test.
@@ -327,6 +1025,209 @@ onSelectSoakTest(
     return error;
 }
 
+//
+// Handler for the soak stats selector to show the statistics of the last
+// soak test. UP & DOWN move through the selections and SELECT sends the
+// whole table to the serial port.
+//
+PERROR
+onSelectSoakStats(
+    void *context,
+    int  key
+)
+{
+    PERROR error = errorCustom;
+    const SOAK_STATS *stats;
+    SELECTOR entry;
+
+    if (s_soakNumSelections == 0)
+    {
+        stringCopy(errorCustom->description, "E: No soak test");
+        errorCustom->code = ERROR_FAILED;
+        return error;
+    }
+
+    //
+    // Move to the next or previous selection skipping over sub menus.
+    //
+    if ((key == UP_KEY) || (key == DOWN_KEY))
+    {
+        do
+        {
+            if (key == UP_KEY)
+            {
+                s_soakStatsSelection = (s_soakStatsSelection + 1) % s_soakNumSelections;
+            }
+            else
+            {
+                s_soakStatsSelection = (s_soakStatsSelection + s_soakNumSelections - 1) % s_soakNumSelections;
+            }
+
+            CRegion::get(CGameCallback::selectorSoakTest, s_soakStatsSelection, &entry);
+        }
+        while (entry.subMenu);
+    }
+
+    if (key == SELECT_KEY)
+    {
+        soakStatsPrint();
+    }
+
+    //
+    // The index, pass/run count and average duration e.g. "3:120/121 2340ms"
+    // The rest is available over the serial port.
+    //
+    stats = &s_soakStats[s_soakStatsSelection];
+
+    stringCopy(errorCustom->description, "");
+    stringAppendDec(errorCustom->description, s_soakStatsSelection);
+    stringAppend(errorCustom->description, ":");
+    stringAppendDec(errorCustom->description, stats->runs - stats->failures);
+    stringAppend(errorCustom->description, "/");
+    stringAppendDec(errorCustom->description, stats->runs);
+
+    if (stats->notImplemented)
+    {
+        stringAppend(errorCustom->description, " N/A");
+    }
+    else
+    {
+        stringAppend(errorCustom->description, " ");
+        stringAppendDec(errorCustom->description, (stats->runs != 0) ? (stats->totalMs / stats->runs) : 0);
+        stringAppend(errorCustom->description, "ms");
+    }
+
+    errorCustom->code = ERROR_SUCCESS;
+
+    return error;
+}
+
+//
+// Handler for the show log selector to show the failure log records, newest
+// first. UP & DOWN move through the records and SELECT sends the whole log
+// to the serial port.
+//
+PERROR
+onSelectShowLog(
+    void *context,
+    int  key
+)
+{
+    PERROR error = errorCustom;
+    CFailureLog::RECORD record;
+    UINT16 count = CFailureLog::count();
+
+    if (count == 0)
+    {
+        stringCopy(errorCustom->description, "OK: Log empty");
+        errorCustom->code = ERROR_SUCCESS;
+        return error;
+    }
+
+    if (key == UP_KEY)
+    {
+        s_logIndex = (s_logIndex + 1) % count;
+    }
+    else if (key == DOWN_KEY)
+    {
+        s_logIndex = (s_logIndex + count - 1) % count;
+    }
+    else if (key == SELECT_KEY)
+    {
+        logPrint();
+    }
+
+    if (s_logIndex >= count)
+    {
+        s_logIndex = 0;
+    }
+
+    //
+    // The index and packed detail e.g. "0:3c12 0055 00aa"
+    // The rest is available over the serial port.
+    //
+    stringCopy(errorCustom->description, "");
+    stringAppendDec(errorCustom->description, s_logIndex);
+    stringAppend(errorCustom->description, ":");
+
+    if (CFailureLog::get(s_logIndex, &record))
+    {
+        stringAppendHex(errorCustom->description, record.address, (record.address > 0xFFFF) ? 6 : 4);
+        STRING_UINT16_HEX(errorCustom->description, record.expected);
+        STRING_UINT16_HEX(errorCustom->description, record.received);
+    }
+    else
+    {
+        stringAppend(errorCustom->description, "Bad record");
+    }
+
+    errorCustom->code = ERROR_SUCCESS;
+
+    return error;
+}
+
+
+//
+// Handler for the show trace selector to step through the bus accesses made by
+// the last traced test, most recent first. SELECT sends them all to the serial
+// port.
+//
+PERROR
+onSelectShowTrace(
+    void *context,
+    int  key
+)
+{
+    PERROR error = errorCustom;
+    TRACE_ENTRY entry;
+    UINT8 count = CTraceCpu::count();
+
+    if (count == 0)
+    {
+        stringCopy(errorCustom->description, "OK: Trace empty");
+        errorCustom->code = ERROR_SUCCESS;
+        return error;
+    }
+
+    if (key == UP_KEY)
+    {
+        s_traceIndex = (s_traceIndex + 1) % count;
+    }
+    else if (key == DOWN_KEY)
+    {
+        s_traceIndex = (s_traceIndex + count - 1) % count;
+    }
+    else if (key == SELECT_KEY)
+    {
+        tracePrint();
+    }
+
+    if (s_traceIndex >= count)
+    {
+        s_traceIndex = 0;
+    }
+
+    //
+    // e.g. "3:W 3c12 0055 F"
+    //
+    CTraceCpu::get(s_traceIndex, &entry);
+
+    stringCopy(errorCustom->description, "");
+    stringAppendDec(errorCustom->description, s_traceIndex);
+    stringAppend(errorCustom->description, (entry.flags & TRACE_FLAG_WRITE) ? ":W " : ":R ");
+    stringAppendHex(errorCustom->description, entry.address, (entry.address > 0xFFFF) ? 6 : 4);
+    STRING_UINT16_HEX(errorCustom->description, entry.data);
+
+    if (entry.flags & TRACE_FLAG_FAILED)
+    {
+        stringAppend(errorCustom->description, " F");
+    }
+
+    errorCustom->code = ERROR_SUCCESS;
+
+    return error;
+}
+
 
 void mainSetup(
     const SELECTOR *gameSelector
@@ -343,26 +1244,23 @@ void mainSetup(
 
     keypad.setRate(10);
 
-    // Copy the PROGMEM based selectors into a single local SRAM selector
-    {
-        UINT16 uConfigRegionSize = 0;
-        UINT16 uConfigIndexCount = 0;
-
-        UINT16 uGameRegionSize   = 0;
-        UINT16 uGameIndexCount   = 0;
+    CScheduler::begin();
+    CScheduler::addTask(onHeartbeatTask, NULL, 500);
+    CScheduler::addTask(onKeypadTask,    NULL, 20);
+    CScheduler::addTask(onBusyTask,      NULL, 250);
+    CScheduler::addTask(onSerialTask,    NULL, 50);
 
-        for ( ; pgm_read_word_near(&s_configSelector[uConfigIndexCount].function) != 0 ; uConfigIndexCount++) {}
+    Serial.begin(115200);
 
-        for ( ; pgm_read_word_near(&gameSelector[uGameIndexCount].function) != 0 ; uGameIndexCount++) {}
+    CFailureLog::begin();
 
-        uConfigRegionSize += sizeof(s_configSelector[0]) * uConfigIndexCount;
-        uGameRegionSize += sizeof(gameSelector[0]) * (uGameIndexCount+1); // +1 to include the null terminator.
-
-        s_gameSelector = (PSELECTOR) malloc( uConfigRegionSize + uGameRegionSize );
-
-        memcpy_P( &s_gameSelector[0], s_configSelector, uConfigRegionSize );
-        memcpy_P( &s_gameSelector[uConfigIndexCount], gameSelector, uGameRegionSize );
-    }
+    //
+    // The game selector is used in place from PROGMEM with the configuration
+    // selections in front of the games (see getSelection).
+    //
+    s_progMemGameSelector = gameSelector;
+    s_gameSelector        = s_configSelector;
+    s_configSelections    = (UINT8) CRegion::count(s_configSelector);
 
     s_currentSelector = s_gameSelector;
 }
@@ -373,7 +1271,12 @@ void mainLoop()
 
     do {
 
-        int currentKey = keypad.getKey();
+        int currentKey;
+        SELECTOR selection;
+
+        CScheduler::yield();
+
+        currentKey = CScheduler::getKey();
 
         //
         // Special case of the first pass through to park at the first selector.
@@ -386,10 +1289,6 @@ void mainLoop()
         if ( (currentKey == SAMPLE_WAIT) ||
              (currentKey == previousKey) )
         {
-            digitalWrite(led, LOW);
-            delay(100);
-            digitalWrite(led, HIGH);
-
             continue;
         }
 
@@ -404,14 +1303,16 @@ void mainLoop()
                     s_currentSelection--;
                 }
 
+                getSelection(s_currentSelector, s_currentSelection, &selection);
+
                 lcd.clear();
                 lcd.setCursor(0, 0);
-                lcd.print(s_currentSelector[s_currentSelection].description);
+                lcd.print(selection.description);
 
-                if (s_currentSelector[s_currentSelection].subMenu)
+                if (selection.subMenu)
                 {
-                    PERROR error = s_currentSelector[s_currentSelection].function(
-                        s_currentSelector[s_currentSelection].context,
+                    PERROR error = selection.function(
+                        selection.context,
                         NO_KEY );
 
                     lcd.setCursor(0, 1);
@@ -423,19 +1324,21 @@ void mainLoop()
 
             case RIGHT_KEY :
             {
-                if (s_currentSelector[s_currentSelection+1].function != NULL)
+                if (getSelection(s_currentSelector, s_currentSelection+1, &selection))
                 {
                     s_currentSelection++;
                 }
 
+                getSelection(s_currentSelector, s_currentSelection, &selection);
+
                 lcd.clear();
                 lcd.setCursor(0, 0);
-                lcd.print(s_currentSelector[s_currentSelection].description);
+                lcd.print(selection.description);
 
-                if (s_currentSelector[s_currentSelection].subMenu)
+                if (selection.subMenu)
                 {
-                    PERROR error = s_currentSelector[s_currentSelection].function(
-                        s_currentSelector[s_currentSelection].context,
+                    PERROR error = selection.function(
+                        selection.context,
                         NO_KEY );
 
                     lcd.setCursor(0, 1);
@@ -448,13 +1351,15 @@ void mainLoop()
             case UP_KEY     :
             case DOWN_KEY   :
             {
-                if (s_currentSelector[s_currentSelection].subMenu)
+                getSelection(s_currentSelector, s_currentSelection, &selection);
+
+                if (selection.subMenu)
                 {
                     lcd.setCursor(0, 1);
                     lcd.print(BLANK_LINE_16);
 
-                    PERROR error = s_currentSelector[s_currentSelection].function(
-                                    s_currentSelector[s_currentSelection].context,
+                    PERROR error = selection.function(
+                                    selection.context,
                                     currentKey );
 
                     lcd.setCursor(0, 1);
@@ -469,29 +1374,134 @@ void mainLoop()
                 unsigned long endTime = startTime + ((unsigned long) s_repeatSelectTimeInS * 1000);
                 const SELECTOR *inSelector = s_currentSelector;
                 PERROR error = errorSuccess;
+                bool traced = false;
 
                 lcd.setCursor(0, 1);
                 lcd.print(BLANK_LINE_16);
 
+                CScheduler::clearAbort();
+                CScheduler::clearProgress();
+
+                paintMemory();
+                s_memoryCollision = false;
+
+#if TEST_TIMING
+                CTestTiming::clear();
+#endif
+
+                //
+                // Only the tests are traced, not the configuration & game selections.
+                //
+                if (s_busTrace                      &&
+                    (CGameCallback::game != NULL)   &&
+                    (inSelector != s_gameSelector))
+                {
+                    traced = true;
+                    s_traceIndex = 0;
+                    CTraceCpu::clear();
+                    CGameCallback::game->trace(true);
+                }
+
+                s_busy = true;
+
                 do {
 
-                    error = s_currentSelector[s_currentSelection].function(
-                               s_currentSelector[s_currentSelection].context,
+                    memset(&errorDetail, 0, sizeof(errorDetail));
+
+                    getSelection(s_currentSelector, s_currentSelection, &selection);
+
+                    error = selection.function(
+                               selection.context,
                                currentKey );
+
+                    //
+                    // Failures whilst repeating are logged since they may not
+                    // be the one left on the display.
+                    //
+                    if (s_repeatSelectTimeInS != 0)
+                    {
+                        logFailure(s_currentSelector, s_currentSelection, error);
+                    }
+
+                    //
+                    // The guard scans the whole gap so it's run once per test
+                    // rather than from the busy task in the middle of the bus cycles.
+                    //
+                    if (s_memoryGuard &&
+                        (freeMemoryLowWater() < c_memoryGuardBytes))
+                    {
+                        s_memoryCollision = true;
+                    }
                 }
                 while ( (s_repeatIgnoreError || SUCCESS(error)) &&  // Ignoring or no failures
                         (millis() < endTime)                    &&  // Times not up.
-                        (inSelector != s_gameSelector) );           // The input selector wasn't the game selector.
+                        (inSelector != s_gameSelector)          &&  // The input selector wasn't the game selector.
+                        !s_memoryCollision                      &&  // The stack & heap haven't collided.
+                        !CScheduler::aborted() );                   // Not aborted.
+
+                s_busy = false;
+
+                if (traced)
+                {
+                    CGameCallback::game->trace(false);
+
+                    if (FAILED(error))
+                    {
+                        tracePrint();
+                    }
+                }
+
+                if (s_memoryCollision)
+                {
+                    error = errorCustom;
+                    error->code = ERROR_FAILED;
+                    stringCopy(error->description, "E:Stack/Heap");
+                    STRING_UINT16_HEX(error->description, freeMemoryLowWater());
+                    onAborted();
+                }
+                else if (CScheduler::aborted())
+                {
+                    error = errorAborted;
+                    onAborted();
+                }
+
+                //
+                // Only the tests report their memory use, not the configuration & game selections.
+                //
+                if (inSelector != s_gameSelector)
+                {
+                    getSelection(s_currentSelector, s_currentSelection, &selection);
+
+                    memoryPrint(&selection);
+                }
+
+                //
+                // Keys pressed whilst the selection ran were queued by the keypad task.
+                // Discard them but track the last one so that a key release isn't lost.
+                //
+                for (int key = CScheduler::getKey() ; key != SAMPLE_WAIT ; key = CScheduler::getKey())
+                {
+                    currentKey = key;
+                }
 
                 //
                 // The selection may have changed so update the whole display.
                 //
+                getSelection(s_currentSelector, s_currentSelection, &selection);
+
                 lcd.clear();
                 lcd.setCursor(0, 0);
-                lcd.print(s_currentSelector[s_currentSelection].description);
+                lcd.print(selection.description);
 
                 lcd.setCursor(0, 1);
                 lcd.print(error->description);
+
+#if TEST_TIMING
+                if (CTestTiming::valid())
+                {
+                    timingPrint(&selection, error);
+                }
+#endif
             }
 
             default : { break; };
@@ -35,7 +35,8 @@
 extern int s_repeatSelectTimeInS;
 
 //
-// When true causes the repeat to ignore any reported error and continue the repeat
+// When true causes the repeat to ignore any reported error and continue the repeat.
+// The soak test also uses this to record failures and carry on.
 //
 extern bool s_repeatIgnoreError;
 
@@ -77,6 +78,35 @@ onSelectSoakTest(
     int  key
 );
 
+//
+// Handler for the soak stats selector to show the statistics gathered by
+// the last soak test.
+//
+PERROR
+onSelectSoakStats(
+    void *context,
+    int  key
+);
+
+//
+// Handler for the show log selector to show the failure log kept in EEPROM.
+//
+PERROR
+onSelectShowLog(
+    void *context,
+    int  key
+);
+
+//
+// Handler for the show trace selector to show the bus accesses recorded by
+// the last traced test.
+//
+PERROR
+onSelectShowTrace(
+    void *context,
+    int  key
+);
+
 //
 // This is the main entry point for the Arduino script files into the normal C++ domain.
 //
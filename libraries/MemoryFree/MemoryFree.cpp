@@ -5,6 +5,15 @@ extern void *__brkval;
 
 #include "MemoryFree.h"
 
+#include <avr/io.h>
+
+#define MEMORY_PAINT 0xC5
+
+//
+// Where the last paint started (the top of the heap at the time).
+//
+static unsigned char *s_paintStart = (unsigned char *) &__heap_start;
+
 
 int freeMemory() {
   int free_memory;
@@ -16,3 +25,78 @@ int freeMemory() {
 
   return free_memory;
 }
+
+//
+// Paint all of the memory above the heap at boot, before the constructors run.
+// This is inlined into the start up code so it must not use the stack.
+//
+void paintMemoryAtBoot() __attribute__ ((naked, used, section (".init3")));
+
+void paintMemoryAtBoot() {
+  unsigned char *p = (unsigned char *) &__heap_start;
+
+  while (p <= (unsigned char *) RAMEND)
+    *p++ = MEMORY_PAINT;
+}
+
+void paintMemory() {
+  unsigned char marker;
+  unsigned char *p;
+
+  if((int)__brkval == 0)
+    p = (unsigned char *) &__heap_start;
+  else
+    p = (unsigned char *) __brkval;
+
+  s_paintStart = p;
+
+  // Stop short of this frame, the paint loop is below it.
+  while (p < (&marker - 8))
+    *p++ = MEMORY_PAINT;
+}
+
+//
+// Find the longest run of paint left. The heap has been up to the start of it
+// and the stack down to the end of it.
+//
+static int findPaint(unsigned char **start, unsigned char **end) {
+  unsigned char marker;
+  unsigned char *p = s_paintStart;
+  unsigned char *runStart = p;
+
+  *start = p;
+  *end   = p;
+
+  for ( ; p < &marker ; p++) {
+    if (*p != MEMORY_PAINT)
+      runStart = p + 1;
+    else if ((p + 1 - runStart) > (*end - *start)) {
+      *start = runStart;
+      *end   = p + 1;
+    }
+  }
+
+  return (int) (*end - *start);
+}
+
+int stackHighWater() {
+  unsigned char *start, *end;
+
+  findPaint(&start, &end);
+
+  return (int) ((unsigned char *) RAMEND + 1 - end);
+}
+
+int heapHighWater() {
+  unsigned char *start, *end;
+
+  findPaint(&start, &end);
+
+  return (int) (start - (unsigned char *) &__heap_start);
+}
+
+int freeMemoryLowWater() {
+  unsigned char *start, *end;
+
+  return findPaint(&start, &end);
+}
@@ -7,6 +7,27 @@ extern "C" {
 
 int freeMemory();
 
+//
+// High water marks. The free memory between the heap and the stack is painted
+// with a known pattern at boot so the deepest the stack and highest the heap
+// have reached can be found from what's left of the pattern.
+//
+// paintMemory repaints the current gap to start a new measurement, for example
+// before each selection is run.
+//
+
+void paintMemory();
+
+// The most stack used (bytes below the end of RAM) since the last paint.
+int stackHighWater();
+
+// The most heap used (bytes above the start of the heap) since the last paint.
+int heapHighWater();
+
+// The smallest gap there has been between the heap and the stack since the
+// last paint. A gap of zero means they have collided.
+int freeMemoryLowWater();
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// Converts a binary deep capture (see CCapture::captureDeep) saved in a
+// serial log into a Value Change Dump (VCD) file for a waveform viewer.
+//
+// The log is searched for the last "CAPTURE,Bin,<runs>,<clocks>" line, it's
+// followed by <runs> pairs of bytes: the J14 AUX port value (bit 0 = AUX1)
+// and the number of further clocks it was held for. The VCD written is the
+// same as the one the tester streams in VCD mode.
+//
+// Usage: CaptureToVcd log.bin [output.vcd]
+//
+// The log must be saved raw (binary), a terminal that translates line endings
+// will corrupt the runs.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static const char s_header[] = "CAPTURE,Bin,";
+
+static const int c_auxPins = 8;
+
+
+static bool
+readFile(
+    const char                 *name,
+    std::vector<unsigned char> &data
+)
+{
+    FILE *file = fopen(name, "rb");
+
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    unsigned char block[4096];
+    size_t        count;
+
+    while ((count = fread(block, 1, sizeof(block), file)) != 0)
+    {
+        data.insert(data.end(), block, block + count);
+    }
+
+    fclose(file);
+
+    return true;
+}
+
+
+static void
+writeVcd(
+    FILE                *out,
+    const unsigned char *runData,
+    unsigned int         runs
+)
+{
+    unsigned long time = 0;
+
+    fprintf(out, "$version arduino-mega-ict CCapture $end\n");
+    fprintf(out, "$comment One time unit is one clock pulse $end\n");
+    fprintf(out, "$timescale 1 ns $end\n");
+    fprintf(out, "$scope module aux $end\n");
+
+    for (int pin = 0 ; pin < c_auxPins ; pin++)
+    {
+        fprintf(out, "$var wire 1 %c AUX%c $end\n", '1' + pin, '1' + pin);
+    }
+
+    fprintf(out, "$upscope $end\n");
+    fprintf(out, "$enddefinitions $end\n");
+
+    for (unsigned int run = 0 ; run < runs ; run++)
+    {
+        unsigned char value   = runData[run * 2];
+        unsigned char changed = (run == 0) ? 0xFF : (value ^ runData[(run - 1) * 2]);
+
+        fprintf(out, "#%lu\n", time);
+
+        for (int pin = 0 ; pin < c_auxPins ; pin++)
+        {
+            if (changed & (1 << pin))
+            {
+                fprintf(out, "%c%c\n", (value & (1 << pin)) ? '1' : '0', '1' + pin);
+            }
+        }
+
+        time += (unsigned long) runData[(run * 2) + 1] + 1;
+    }
+
+    fprintf(out, "#%lu\n", time);
+}
+
+
+int
+main(
+    int   argc,
+    char *argv[]
+)
+{
+    std::vector<unsigned char> log;
+    size_t       headerAt = 0;
+    bool         found = false;
+    unsigned int runs = 0;
+    unsigned int clocks = 0;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: CaptureToVcd log.bin [output.vcd]\n");
+        return 1;
+    }
+
+    if (!readFile(argv[1], log))
+    {
+        fprintf(stderr, "Unable to read %s\n", argv[1]);
+        return 1;
+    }
+
+    log.push_back(0);
+
+    //
+    // Find the last capture. The search is forwards, skipping over the run
+    // data of each capture found, as the raw runs could contain the header.
+    //
+    for (size_t index = 0 ; (index + sizeof(s_header) - 1) < log.size() ; )
+    {
+        if (memcmp(&log[index], s_header, sizeof(s_header) - 1) == 0)
+        {
+            unsigned int thisRuns, thisClocks;
+
+            if (sscanf((const char *) &log[index + sizeof(s_header) - 1], "%u,%u", &thisRuns, &thisClocks) == 2)
+            {
+                const unsigned char *lineEnd = (const unsigned char *) memchr(&log[index], '\n', log.size() - index);
+
+                if (lineEnd != NULL)
+                {
+                    size_t dataAt = (lineEnd - &log[0]) + 1;
+
+                    if ((dataAt + (thisRuns * 2)) <= log.size())
+                    {
+                        headerAt = dataAt;
+                        runs     = thisRuns;
+                        clocks   = thisClocks;
+                        found    = true;
+
+                        index = dataAt + (thisRuns * 2);
+                        continue;
+                    }
+                }
+            }
+        }
+
+        index++;
+    }
+
+    if (!found)
+    {
+        fprintf(stderr, "No complete capture found in %s\n", argv[1]);
+        return 1;
+    }
+
+    FILE *out = stdout;
+
+    if (argc > 2)
+    {
+        out = fopen(argv[2], "w");
+
+        if (out == NULL)
+        {
+            fprintf(stderr, "Unable to write %s\n", argv[2]);
+            return 1;
+        }
+    }
+
+    writeVcd(out, &log[headerAt], runs);
+
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+
+    fprintf(stderr, "%u runs, %u clocks\n", runs, clocks);
+
+    return 0;
+}
@@ -0,0 +1,301 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#include "CMemoryCpu.h"
+
+static const char *s_faultName[CMemoryCpu::NUM_FAULTS] = { "None",
+                                                            "DataStuckLo",
+                                                            "DataStuckHi",
+                                                            "AddressStuckLo",
+                                                            "AddressShort",
+                                                            "ChipDead" };
+
+const char *
+CMemoryCpu::faultName(
+    Fault fault
+)
+{
+    return s_faultName[fault];
+}
+
+
+CMemoryCpu::CMemoryCpu(
+    ICpu *widthCpu
+) : m_widthCpu(widthCpu)
+{
+    clear();
+}
+
+
+void
+CMemoryCpu::clear(
+)
+{
+    m_pages.clear();
+    m_fault = NO_FAULT;
+}
+
+
+void
+CMemoryCpu::setFault(
+    Fault             fault,
+    const RAM_REGION *region
+)
+{
+    UINT32 size = region->end - region->start;
+    UINT32 line = 1;
+
+    m_fault      = fault;
+    m_faultStart = region->start;
+    m_faultEnd   = region->end;
+    m_faultMask  = region->mask;
+
+    // The lowest data bit of the chip.
+    m_faultBit = region->mask & (~region->mask + 1);
+
+    // The top address line of the chip and the one below it.
+    while ((line << 1) <= size)
+    {
+        line <<= 1;
+    }
+
+    m_faultLineHi = line;
+    m_faultLineLo = line >> 1;
+}
+
+
+void
+CMemoryCpu::load(
+    UINT32 address,
+    UINT16 data
+)
+{
+    CELL *c = cell(address);
+
+    c->data    = data;
+    c->written = true;
+}
+
+
+CMemoryCpu::CELL *
+CMemoryCpu::cell(
+    UINT32 address
+)
+{
+    std::vector<CELL> &page = m_pages[address >> c_pageShift];
+
+    if (page.empty())
+    {
+        CELL blank = {0, false};
+
+        page.assign(1 << c_pageShift, blank);
+    }
+
+    return &page[address & ((1 << c_pageShift) - 1)];
+}
+
+
+//
+// Unwritten locations read as a hash of the address.
+//
+UINT16
+CMemoryCpu::peek(
+    UINT32 address
+)
+{
+    CELL *c = cell(address);
+
+    if (c->written)
+    {
+        return c->data;
+    }
+    else
+    {
+        UINT32 hash = address * 2654435761UL;
+
+        return (UINT16) (hash >> 13);
+    }
+}
+
+
+bool
+CMemoryCpu::inFault(
+    UINT32 address
+)
+{
+    return (m_fault != NO_FAULT) && (address >= m_faultStart) && (address <= m_faultEnd);
+}
+
+
+//
+// The address the faulty chip actually sees.
+//
+UINT32
+CMemoryCpu::faultAddress(
+    UINT32 address
+)
+{
+    UINT32 offset = address - m_faultStart;
+
+    if (m_fault == ADDRESS_STUCK_LO)
+    {
+        offset &= ~m_faultLineHi;
+    }
+    else if (m_fault == ADDRESS_SHORT)
+    {
+        if (!(offset & m_faultLineHi) || !(offset & m_faultLineLo))
+        {
+            offset &= ~(m_faultLineHi | m_faultLineLo);
+        }
+    }
+
+    return m_faultStart + offset;
+}
+
+
+PERROR
+CMemoryCpu::idle(
+)
+{
+    return errorSuccess;
+}
+
+
+PERROR
+CMemoryCpu::check(
+)
+{
+    return errorSuccess;
+}
+
+
+UINT8
+CMemoryCpu::dataBusWidth(
+    UINT32 address
+)
+{
+    return m_widthCpu->dataBusWidth(address);
+}
+
+
+UINT8
+CMemoryCpu::dataAccessWidth(
+    UINT32 address
+)
+{
+    return m_widthCpu->dataAccessWidth(address);
+}
+
+
+PERROR
+CMemoryCpu::memoryRead(
+    UINT32 address,
+    UINT16 *data
+)
+{
+    UINT16 value = peek(address);
+
+    BUS_STATS_INC(reads);
+
+    if (inFault(address))
+    {
+        UINT16 chip = peek(faultAddress(address));
+
+        switch (m_fault)
+        {
+            case DATA_STUCK_LO : chip &= ~m_faultBit; break;
+            case DATA_STUCK_HI : chip |=  m_faultBit; break;
+            case CHIP_DEAD     : chip  =  0xFFFF;     break;
+            default            :                      break;
+        }
+
+        value = (value & ~m_faultMask) | (chip & m_faultMask);
+    }
+
+    *data = value;
+
+    return errorSuccess;
+}
+
+
+PERROR
+CMemoryCpu::memoryWrite(
+    UINT32 address,
+    UINT16 data
+)
+{
+    BUS_STATS_INC(writes);
+
+    if (inFault(address))
+    {
+        //
+        // The other chips on the address see the write as normal, the faulty
+        // chip takes its bits at the address it sees (if selected at all).
+        //
+        CELL  *c     = cell(address);
+        UINT16 other = peek(address);
+
+        c->data    = (other & m_faultMask) | (data & ~m_faultMask);
+        c->written = true;
+
+        if (m_fault != CHIP_DEAD)
+        {
+            UINT32 chipAddress = faultAddress(address);
+            UINT16 chip        = peek(chipAddress);
+
+            c = cell(chipAddress);
+
+            c->data    = (chip & ~m_faultMask) | (data & m_faultMask);
+            c->written = true;
+        }
+    }
+    else
+    {
+        load(address, data);
+    }
+
+    return errorSuccess;
+}
+
+
+PERROR
+CMemoryCpu::waitForInterrupt(
+    Interrupt interrupt,
+    bool      active,
+    UINT32    timeoutInMs
+)
+{
+    return errorNotImplemented;
+}
+
+
+PERROR
+CMemoryCpu::acknowledgeInterrupt(
+    UINT16 *response
+)
+{
+    *response = 0;
+
+    return errorSuccess;
+}
@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+#ifndef CMemoryCpu_h
+#define CMemoryCpu_h
+
+#include "Arduino.h"
+#include "ICpu.h"
+
+#include <unordered_map>
+#include <vector>
+
+//
+// An ICpu backed by host memory for running the test algorithms off target.
+//
+// The bus widths are taken from the game's real CPU driver so the tests
+// step through the address space exactly as they do on the board. Locations
+// that have not been written read back as a hash of the address, this is the
+// "ROM" content outside of the data2n samples that are loaded.
+//
+// One fault at a time can be injected into a region. The fault only affects
+// the data bits in the region mask so that the other chips sharing the
+// addresses (e.g. the two 4-bit 2114's of a byte) still work.
+//
+class CMemoryCpu : public ICpu
+{
+    public:
+
+        typedef enum {
+            NO_FAULT,
+            DATA_STUCK_LO,      // Lowest data bit of the mask reads 0.
+            DATA_STUCK_HI,      // Lowest data bit of the mask reads 1.
+            ADDRESS_STUCK_LO,   // Top address line of the chip is held low.
+            ADDRESS_SHORT,      // Top two address lines of the chip are shorted (wired AND).
+            CHIP_DEAD,          // Chip select never asserted, reads float high.
+            NUM_FAULTS
+        } Fault;
+
+        static const char *faultName(
+            Fault fault
+        );
+
+        CMemoryCpu(
+            ICpu *widthCpu
+        );
+
+        //
+        // Forget everything written and remove the fault.
+        //
+        void clear(
+        );
+
+        //
+        // Set the fault into the region, the start/end/step/mask are used.
+        //
+        void setFault(
+            Fault             fault,
+            const RAM_REGION *region
+        );
+
+        //
+        // Store without going through the fault, i.e. the ROM content.
+        //
+        void load(
+            UINT32 address,
+            UINT16 data
+        );
+
+        //
+        // ICpu Interface
+        //
+
+        virtual
+        PERROR
+        idle(
+        );
+
+        virtual
+        PERROR
+        check(
+        );
+
+        virtual
+        UINT8
+        dataBusWidth(
+            UINT32 address
+        );
+
+        virtual
+        UINT8
+        dataAccessWidth(
+            UINT32 address
+        );
+
+        virtual
+        PERROR
+        memoryRead(
+            UINT32 address,
+            UINT16 *data
+        );
+
+        virtual
+        PERROR
+        memoryWrite(
+            UINT32 address,
+            UINT16 data
+        );
+
+        virtual
+        PERROR
+        waitForInterrupt(
+            Interrupt interrupt,
+            bool      active,
+            UINT32    timeoutInMs
+        );
+
+        virtual
+        PERROR
+        acknowledgeInterrupt(
+            UINT16 *response
+        );
+
+    private:
+
+        static const UINT32 c_pageShift = 8;
+
+        typedef struct _CELL {
+
+            UINT16 data;
+            bool   written;
+
+        } CELL;
+
+        CELL *cell(
+            UINT32 address
+        );
+
+        UINT16 peek(
+            UINT32 address
+        );
+
+        bool inFault(
+            UINT32 address
+        );
+
+        UINT32 faultAddress(
+            UINT32 address
+        );
+
+        ICpu *m_widthCpu;
+
+        std::unordered_map<UINT32, std::vector<CELL> > m_pages;
+
+        Fault  m_fault;
+        UINT32 m_faultStart;
+        UINT32 m_faultEnd;
+        UINT16 m_faultMask;
+        UINT16 m_faultBit;
+        UINT32 m_faultLineHi;
+        UINT32 m_faultLineLo;
+};
+
+#endif
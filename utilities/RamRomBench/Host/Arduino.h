@@ -0,0 +1,101 @@
+//
+// Host build of the parts of the Arduino core used by the tester library
+// so that the test algorithms can be run on a PC (see RamRomBench.cpp).
+//
+// The pin functions do nothing, the CPU drivers are constructed by the games
+// but the benchmark replaces them with CMemoryCpu.
+//
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <avr/pgmspace.h>
+#include <avr/io.h>
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define HIGH         1
+#define LOW          0
+
+#define INPUT        0
+#define OUTPUT       1
+#define INPUT_PULLUP 2
+
+#define HEX          16
+#define DEC          10
+
+#define A0           54
+#define A1           55
+#define A2           56
+#define A3           57
+#define A4           58
+#define A5           59
+#define A6           60
+#define A7           61
+#define A8           62
+#define A9           63
+#define A10          64
+#define A11          65
+#define A12          66
+#define A13          67
+#define A14          68
+#define A15          69
+
+#define NOT_A_PIN    0
+
+#define digitalPinToPort(p)     ((uint8_t) (p))
+#define digitalPinToBitMask(p)  ((uint8_t) 1)
+#define portOutputRegister(p)   (&PORTA)
+#define portInputRegister(p)    (&PINA)
+#define portModeRegister(p)     (&DDRA)
+
+#define F(s)   ((const __FlashStringHelper *) (s))
+
+class __FlashStringHelper;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int  digitalRead(uint8_t pin);
+int  analogRead(uint8_t pin);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void noInterrupts();
+void interrupts();
+
+extern volatile uint8_t SREG;
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+//
+// The serial port goes to stdout.
+//
+class HardwareSerial
+{
+    public:
+        void   begin(unsigned long baud) {}
+        size_t print(const char *s)                    { return printf("%s", s); }
+        size_t print(char c)                           { return printf("%c", c); }
+        size_t print(unsigned long n, int base = DEC)  { return printf((base == HEX) ? "%lX" : "%lu", n); }
+        size_t print(unsigned int n, int base = DEC)   { return print((unsigned long) n, base); }
+        size_t print(int n, int base = DEC)            { return (base == HEX) ? print((unsigned long) n, base) : printf("%d", n); }
+        size_t println()                               { return printf("\r\n"); }
+        template <typename T> size_t println(T v)           { return print(v) + println(); }
+        template <typename T> size_t println(T v, int base) { return print(v, base) + println(); }
+        size_t write(uint8_t b)                        { return fwrite(&b, 1, 1, stdout); }
+        size_t write(const uint8_t *b, size_t size)    { return fwrite(b, 1, size, stdout); }
+};
+
+extern HardwareSerial Serial;
+
+#endif
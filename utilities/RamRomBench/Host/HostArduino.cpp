@@ -0,0 +1,95 @@
+//
+// Host build of the Arduino core functions, see Arduino.h.
+//
+#include "Arduino.h"
+#include <chrono>
+
+#undef AVR_REGISTER
+#define AVR_REGISTER(r) volatile uint8_t r;
+
+AVR_REGISTER(PINA) AVR_REGISTER(PORTA) AVR_REGISTER(DDRA)
+AVR_REGISTER(PINB) AVR_REGISTER(PORTB) AVR_REGISTER(DDRB)
+AVR_REGISTER(PINC) AVR_REGISTER(PORTC) AVR_REGISTER(DDRC)
+AVR_REGISTER(PIND) AVR_REGISTER(PORTD) AVR_REGISTER(DDRD)
+AVR_REGISTER(PINE) AVR_REGISTER(PORTE) AVR_REGISTER(DDRE)
+AVR_REGISTER(PINF) AVR_REGISTER(PORTF) AVR_REGISTER(DDRF)
+AVR_REGISTER(PING) AVR_REGISTER(PORTG) AVR_REGISTER(DDRG)
+AVR_REGISTER(PINH) AVR_REGISTER(PORTH) AVR_REGISTER(DDRH)
+AVR_REGISTER(PINJ) AVR_REGISTER(PORTJ) AVR_REGISTER(DDRJ)
+AVR_REGISTER(PINK) AVR_REGISTER(PORTK) AVR_REGISTER(DDRK)
+AVR_REGISTER(PINL) AVR_REGISTER(PORTL) AVR_REGISTER(DDRL)
+AVR_REGISTER(TCNT0) AVR_REGISTER(OCR0A) AVR_REGISTER(TIMSK0)
+
+HardwareSerial Serial;
+
+static const std::chrono::steady_clock::time_point s_start = std::chrono::steady_clock::now();
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t value) {}
+int  digitalRead(uint8_t pin) { return HIGH; }
+int  analogRead(uint8_t pin) { return 1023; }
+
+unsigned long
+micros(
+)
+{
+    return (unsigned long) std::chrono::duration_cast<std::chrono::microseconds>(
+                               std::chrono::steady_clock::now() - s_start).count();
+}
+
+unsigned long
+millis(
+)
+{
+    return micros() / 1000;
+}
+
+void
+delay(
+    unsigned long ms
+)
+{
+    unsigned long start = millis();
+
+    while ((millis() - start) < ms) {}
+}
+
+void
+delayMicroseconds(
+    unsigned int us
+)
+{
+    unsigned long start = micros();
+
+    while ((micros() - start) < us) {}
+}
+
+volatile uint8_t SREG = 0;
+
+void noInterrupts() {}
+void interrupts() {}
+
+long
+random(
+    long max
+)
+{
+    return (max == 0) ? 0 : (rand() % max);
+}
+
+long
+random(
+    long min,
+    long max
+)
+{
+    return min + random(max - min);
+}
+
+void
+randomSeed(
+    unsigned long seed
+)
+{
+    srand((unsigned int) seed);
+}
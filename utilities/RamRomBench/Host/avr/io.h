@@ -0,0 +1,36 @@
+//
+// Host build of <avr/io.h>. The port & timer registers the drivers touch
+// are plain variables, nothing is connected to them.
+//
+#ifndef io_h
+#define io_h
+
+#include <stdint.h>
+
+#define AVR_REGISTER(r) extern volatile uint8_t r;
+
+AVR_REGISTER(PINA) AVR_REGISTER(PORTA) AVR_REGISTER(DDRA)
+AVR_REGISTER(PINB) AVR_REGISTER(PORTB) AVR_REGISTER(DDRB)
+AVR_REGISTER(PINC) AVR_REGISTER(PORTC) AVR_REGISTER(DDRC)
+AVR_REGISTER(PIND) AVR_REGISTER(PORTD) AVR_REGISTER(DDRD)
+AVR_REGISTER(PINE) AVR_REGISTER(PORTE) AVR_REGISTER(DDRE)
+AVR_REGISTER(PINF) AVR_REGISTER(PORTF) AVR_REGISTER(DDRF)
+AVR_REGISTER(PING) AVR_REGISTER(PORTG) AVR_REGISTER(DDRG)
+AVR_REGISTER(PINH) AVR_REGISTER(PORTH) AVR_REGISTER(DDRH)
+AVR_REGISTER(PINJ) AVR_REGISTER(PORTJ) AVR_REGISTER(DDRJ)
+AVR_REGISTER(PINK) AVR_REGISTER(PORTK) AVR_REGISTER(DDRK)
+AVR_REGISTER(PINL) AVR_REGISTER(PORTL) AVR_REGISTER(DDRL)
+AVR_REGISTER(TCNT0) AVR_REGISTER(OCR0A) AVR_REGISTER(TIMSK0)
+
+#define OCIE0A 1
+
+//
+// Interrupt handlers are compiled as plain functions that are never called.
+//
+#define ISR(vector) extern "C" void vector(void)
+
+#define _BV(b) (1 << (b))
+
+#define RAMEND 0x21FF
+
+#endif
@@ -0,0 +1,29 @@
+//
+// Host build of <avr/pgmspace.h>. There is only one address space so
+// PROGMEM data is read in place.
+//
+#ifndef pgmspace_h
+#define pgmspace_h
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P                   const char *
+#define PSTR(s)                 (s)
+
+#define pgm_read_byte(a)        (*(const uint8_t  *) (a))
+#define pgm_read_word(a)        (*(const uint16_t *) (a))
+#define pgm_read_dword(a)       (*(const uint32_t *) (a))
+#define pgm_read_ptr(a)         (*(void * const *) (a))
+
+#define pgm_read_byte_near(a)   pgm_read_byte(a)
+#define pgm_read_word_near(a)   pgm_read_word(a)
+#define pgm_read_dword_near(a)  pgm_read_dword(a)
+#define pgm_read_ptr_near(a)    pgm_read_ptr(a)
+
+#define memcpy_P                memcpy
+#define strcpy_P                strcpy
+#define strlen_P                strlen
+
+#endif
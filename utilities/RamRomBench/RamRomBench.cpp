@@ -0,0 +1,455 @@
+//
+// Copyright (c) 2015, Paul R. Swan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS
+// OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR
+// TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//
+// Host benchmark of the RAM & ROM test algorithms.
+//
+// Runs the CRamCheck & CRomCheck entry points against CMemoryCpu using the
+// region tables of real games, with no fault and then with each of the
+// injected faults in turn, and writes a CSV line per run:
+//
+//   game,test,fault,result,reads,writes,nsPerAccess
+//
+// "result" is pass/fail (n/a if the game has no region for the test). A fail
+// with a fault injected is a detection, a fail with no fault is a false alarm.
+// The bus cycle counts are the ones the board would make, the host time is
+// only useful for comparing algorithm changes against each other.
+//
+// The faults are put in the first RAM region and the first ROM region of the
+// game. The ROM content is a hash of the address with the data2n samples
+// loaded over it, the expected CRC is that of the fault free content.
+//
+// Usage: RamRomBench [output.csv]
+//
+// Build (Visual Studio): RamRomBench.sln, it compiles the library sources in
+// place with the Arduino core replaced by the Host directory.
+//
+
+#include "Arduino.h"
+#include "CMemoryCpu.h"
+#include "CGame.h"
+#include "CRamCheck.h"
+#include "CRomCheck.h"
+#include "CRegion.h"
+
+#include "CGalaxianGame.h"
+#include "CKonamiGTGame.h"
+#include "CStarWarsGame.h"
+#include "CCvsGame.h"
+
+#include <chrono>
+#include <vector>
+
+//
+// Gives access to the tables & CPU of a constructed game.
+//
+class CBenchGame : public CGame
+{
+    public:
+
+        static CBenchGame *from(
+            IGame *game
+        )
+        {
+            return (CBenchGame *) ((CGame *) game);
+        };
+
+        ICpu **cpuSlot()                      { return &m_cpu; };
+        const ROM_REGION *romRegion()         { return m_romRegion; };
+        bool romData2nInProgMem()             { return (m_romData2n != NULL); };
+        const RAM_REGION *ramRegion()         { return m_ramRegion; };
+        const RAM_REGION *ramRegionByteOnly() { return m_ramRegionByteOnly; };
+        const RAM_REGION *ramRegionWriteOnly(){ return m_ramRegionWriteOnly; };
+        UINT32 addressOffset()                { return m_addressOffset; };
+};
+
+typedef struct _BENCH_GAME {
+
+    const char      *name;
+    GameConstructor  create;
+
+} BENCH_GAME;
+
+static const BENCH_GAME s_benchGame[] = { {"Galaxian",     (GameConstructor) CGalaxianGame::createInstanceSet1},
+                                          {"Konami GX400", (GameConstructor) CKonamiGTGame::createInstance},
+                                          {"Star Wars",    (GameConstructor) CStarWarsGame::createInstance},
+                                          {"CVS",          (GameConstructor) CCvsGame::createInstanceHunchbackSet1} };
+
+typedef enum {
+    RAM_CHECK,
+    RAM_CHECK_CHIP_SELECT,
+    RAM_CHECK_RANDOM_ACCESS,
+    RAM_CHECK_ADDRESS,
+    RAM_WRITE_READ,
+    ROM_CHECK,
+    ROM_CALCULATE_CRC,
+    NUM_TESTS
+} Test;
+
+static const char *s_testName[NUM_TESTS] = { "RamCheck",
+                                             "RamCheckChipSelect",
+                                             "RamCheckRandomAccess",
+                                             "RamCheckAddress",
+                                             "RamWriteRead",
+                                             "RomCheck",
+                                             "RomCalculateCrc" };
+
+//
+// Whether the test compares what it reads against an expected value. The
+// write/read and CRC entry points don't, so they can't detect a fault and
+// are shown as n/a in the summary.
+//
+static const bool s_testCompares[NUM_TESTS] = { true,
+                                                true,
+                                                true,
+                                                true,
+                                                false,
+                                                true,
+                                                false };
+
+//
+// Detections per test, [test][fault].
+//
+static int s_detected[NUM_TESTS][CMemoryCpu::NUM_FAULTS];
+static int s_runs[NUM_TESTS][CMemoryCpu::NUM_FAULTS];
+
+//
+// The delays in the RAM tests are for the board (e.g. refresh), they are not
+// part of the algorithm cost so they are skipped.
+//
+static PERROR
+noDelay(
+    void *context,
+    unsigned long ms
+)
+{
+    return errorSuccess;
+}
+
+//
+// Load the data2n samples of a ROM region over the hashed content.
+//
+static void
+loadRom(
+    CMemoryCpu       *memory,
+    const ROM_REGION *region,
+    bool              data2nInProgMem
+)
+{
+    UINT32 busShift = (memory->dataBusWidth(region->start) == 2) ? 1 : 0;
+
+    for (UINT32 shift = 0 ; (1UL << shift) < region->length ; shift++)
+    {
+        UINT16 data = data2nInProgMem ? CRegion::data2n(region->data2n, shift) : region->data2n[shift];
+
+        memory->load(region->start + (1UL << (shift + busShift)), data);
+    }
+}
+
+static PERROR
+runRamTest(
+    Test        test,
+    CBenchGame *game,
+    ICpu       *cpu
+)
+{
+    PERROR error = errorNotImplemented;
+    CRamCheck ramCheck( cpu,
+                        noDelay,
+                        game->ramRegion(),
+                        game->ramRegionByteOnly(),
+                        game->ramRegionWriteOnly(),
+                        (void *) game,
+                        game->addressOffset() );
+
+    if (CRegion::count(game->ramRegion()) == 0)
+    {
+        return error;
+    }
+
+    switch (test)
+    {
+        case RAM_CHECK               : error = ramCheck.check();           break;
+        case RAM_CHECK_CHIP_SELECT   : error = ramCheck.checkChipSelect(); break;
+
+        case RAM_CHECK_RANDOM_ACCESS :
+        {
+            if (CRegion::count(game->ramRegionByteOnly()) != 0)
+            {
+                error = ramCheck.checkRandomAccess();
+            }
+            break;
+        }
+
+        case RAM_CHECK_ADDRESS :
+        {
+            RAM_REGION region;
+
+            for (int index = 0 ; CRegion::get(game->ramRegion(), index, &region, game->addressOffset()) ; index++)
+            {
+                error = ramCheck.checkAddress(&region);
+
+                if (FAILED(error))
+                {
+                    break;
+                }
+            }
+            break;
+        }
+
+        case RAM_WRITE_READ :
+        {
+            error = ramCheck.write();
+
+            if (SUCCESS(error))
+            {
+                error = ramCheck.read();
+            }
+            break;
+        }
+
+        default : break;
+    }
+
+    return error;
+}
+
+//
+// The ROM tests are run a region at a time so that each region (bank) has
+// its own content loaded. "golden" holds the fault free CRC's, they are
+// filled in when the test is run with no fault.
+//
+static PERROR
+runRomTest(
+    Test                  test,
+    CBenchGame           *game,
+    CMemoryCpu           *memory,
+    CMemoryCpu::Fault     fault,
+    std::vector<UINT32>  *golden
+)
+{
+    PERROR error = errorNotImplemented;
+    ROM_REGION region;
+    RAM_REGION faultRegion = {0};
+
+    for (int index = 0 ; CRegion::get(game->romRegion(), index, &region) ; index++)
+    {
+        CRomCheck romCheck( memory,
+                            game->romRegion(),
+                            (void *) game,
+                            game->romData2nInProgMem() );
+        UINT32 crc = 0;
+
+        memory->clear();
+        loadRom(memory, &region, game->romData2nInProgMem());
+
+        if (index == 0)
+        {
+            UINT8 width = memory->dataBusWidth(region.start);
+
+            faultRegion.start = region.start;
+            faultRegion.end   = region.start + (region.length * width) - 1;
+            faultRegion.step  = width;
+            faultRegion.mask  = (memory->dataAccessWidth(region.start) == 2) ? 0xFFFF : 0xFF;
+
+            memory->setFault(fault, &faultRegion);
+        }
+
+        if (test == ROM_CHECK)
+        {
+            error = romCheck.checkData2n(&region);
+        }
+        else
+        {
+            error = errorSuccess;
+        }
+
+        if (SUCCESS(error))
+        {
+            error = romCheck.calculateCrc(&region, &crc);
+        }
+
+        if (SUCCESS(error))
+        {
+            if (fault == CMemoryCpu::NO_FAULT)
+            {
+                golden->push_back(crc);
+            }
+            else if ((test == ROM_CHECK) && (crc != (*golden)[index]))
+            {
+                // Same as CRomCheck::checkCrc against the fault free CRC.
+                error = errorCustom;
+                error->code = ERROR_FAILED;
+            }
+        }
+
+        if (FAILED(error))
+        {
+            break;
+        }
+    }
+
+    return error;
+}
+
+static void
+benchGame(
+    FILE             *csv,
+    const BENCH_GAME *benchGame
+)
+{
+    IGame      *iGame = (IGame *) benchGame->create();
+    CBenchGame *game  = CBenchGame::from(iGame);
+    ICpu       *gameCpu = *game->cpuSlot();
+    CMemoryCpu  memory(gameCpu);
+    RAM_REGION  ramFaultRegion;
+    std::vector<UINT32> golden[NUM_TESTS];
+
+    // The bank switches made by the game go to the memory too.
+    *game->cpuSlot() = &memory;
+
+    bool haveRam = CRegion::get(game->ramRegion(), 0, &ramFaultRegion, game->addressOffset());
+
+    for (int t = 0 ; t < NUM_TESTS ; t++)
+    {
+        Test test = (Test) t;
+
+        for (int f = 0 ; f < CMemoryCpu::NUM_FAULTS ; f++)
+        {
+            CMemoryCpu::Fault fault = (CMemoryCpu::Fault) f;
+            const BUS_STATS *stats = memory.busStats();
+            PERROR error;
+
+            memory.clear();
+            memory.clearBusStats();
+
+            if (haveRam && (test < ROM_CHECK))
+            {
+                memory.setFault(fault, &ramFaultRegion);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+
+            if (test < ROM_CHECK)
+            {
+                error = runRamTest(test, game, &memory);
+            }
+            else
+            {
+                error = runRomTest(test, game, &memory, fault, &golden[test]);
+            }
+
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+            UINT32 accesses = stats->reads + stats->writes;
+            const char *result = (error == errorNotImplemented) ? "n/a" : (SUCCESS(error) ? "pass" : "fail");
+
+            fprintf(csv, "%s,%s,%s,%s,%lu,%lu,%.1f\n",
+                    benchGame->name,
+                    s_testName[test],
+                    CMemoryCpu::faultName(fault),
+                    result,
+                    (unsigned long) stats->reads,
+                    (unsigned long) stats->writes,
+                    (accesses != 0) ? ((double) ns / accesses) : 0.0);
+
+            if (error != errorNotImplemented)
+            {
+                s_runs[test][fault]++;
+
+                if (FAILED(error))
+                {
+                    s_detected[test][fault]++;
+                }
+            }
+        }
+    }
+
+    *game->cpuSlot() = gameCpu;
+}
+
+int
+main(
+    int   argc,
+    char *argv[]
+)
+{
+    const char *fileName = (argc > 1) ? argv[1] : "RamRomBench.csv";
+    FILE *csv = fopen(fileName, "w");
+
+    if (csv == NULL)
+    {
+        fprintf(stderr, "Unable to open %s\n", fileName);
+        return 1;
+    }
+
+    fprintf(csv, "game,test,fault,result,reads,writes,nsPerAccess\n");
+
+    for (size_t g = 0 ; g < (sizeof(s_benchGame) / sizeof(s_benchGame[0])) ; g++)
+    {
+        printf("%s...\n", s_benchGame[g].name);
+        benchGame(csv, &s_benchGame[g]);
+    }
+
+    fclose(csv);
+
+    //
+    // Coverage summary, faults detected out of the games run. The "None"
+    // column counts false alarms. Tests that don't compare anything have
+    // no coverage to show.
+    //
+    printf("\n%-22s", "test");
+
+    for (int f = 0 ; f < CMemoryCpu::NUM_FAULTS ; f++)
+    {
+        printf("%16s", CMemoryCpu::faultName((CMemoryCpu::Fault) f));
+    }
+
+    printf("\n");
+
+    for (int t = 0 ; t < NUM_TESTS ; t++)
+    {
+        printf("%-22s", s_testName[t]);
+
+        for (int f = 0 ; f < CMemoryCpu::NUM_FAULTS ; f++)
+        {
+            char cell[16];
+
+            if (s_testCompares[t])
+            {
+                snprintf(cell, sizeof(cell), "%d/%d", s_detected[t][f], s_runs[t][f]);
+            }
+            else
+            {
+                snprintf(cell, sizeof(cell), "n/a");
+            }
+
+            printf("%16s", cell);
+        }
+
+        printf("\n");
+    }
+
+    return 0;
+}